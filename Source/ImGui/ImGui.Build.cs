@@ -27,7 +27,8 @@ public class ImGui : ModuleRules
 			PrivateDependencyModuleNames.AddRange(new[]
 			{
 				"CoreUObject",
-				"Engine"
+				"Engine",
+				"UMG"
 			});
 		}
 
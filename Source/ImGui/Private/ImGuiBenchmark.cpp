@@ -0,0 +1,661 @@
+#include "ImGuiFilteredLines.h"
+#include "ImGuiPlotHeatmap.h"
+
+#include <HAL/IConsoleManager.h>
+#include <HAL/PlatformTime.h>
+#include <Math/RandomStream.h>
+#include <Misc/OutputDevice.h>
+
+THIRD_PARTY_INCLUDES_START
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <implot.h>
+#include <implot_internal.h>
+THIRD_PARTY_INCLUDES_END
+
+/// Sets up a standalone draw list sharing the current context's draw data, mirroring the flags set by ImGui::NewFrame
+static void ImGui_ResetBenchmarkDrawList(ImDrawList& DrawList, const ImDrawListFlags Flags)
+{
+	DrawList._ResetForNewFrame();
+	DrawList.PushClipRectFullScreen();
+	DrawList.PushTextureID(ImGui::GetIO().Fonts->TexID);
+	DrawList.Flags = Flags | ImDrawListFlags_AllowVtxOffset;
+}
+
+static void ImGui_BenchmarkPolyline(FOutputDevice& Ar)
+{
+	const ImGui::FScopedContext ScopedContext;
+	if (!ScopedContext)
+	{
+		Ar.Log(TEXT("ImGui context is not ready for drawing"));
+		return;
+	}
+
+	struct FPolylineCase
+	{
+		const TCHAR* Name;
+		ImDrawListFlags Flags;
+		float Thickness;
+		bool bFilled;
+	};
+
+	static const FPolylineCase Cases[] = {
+		{ TEXT("Polyline (aliased)"), ImDrawListFlags_None, 1.0f, false },
+		{ TEXT("Polyline (AA, textured)"), ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex, 1.0f, false },
+		{ TEXT("Polyline (AA, thin)"), ImDrawListFlags_AntiAliasedLines, 1.0f, false },
+		{ TEXT("Polyline (AA, thick)"), ImDrawListFlags_AntiAliasedLines, 3.5f, false },
+		{ TEXT("ConvexPolyFilled (AA)"), ImDrawListFlags_AntiAliasedFill, 0.0f, true }
+	};
+
+	static const int32 PointCounts[] = { 10, 100, 1000, 10000, 100000 };
+
+	ImDrawList DrawList(ImGui::GetDrawListSharedData());
+
+	for (const FPolylineCase& Case : Cases)
+	{
+		for (const int32 PointCount : PointCounts)
+		{
+			TArray<ImVec2> Points;
+			Points.SetNumUninitialized(PointCount);
+			for (int32 PointIdx = 0; PointIdx < PointCount; ++PointIdx)
+			{
+				if (Case.bFilled)
+				{
+					// Clockwise circle, filled shapes must be convex
+					const float Angle = -UE_TWO_PI * PointIdx / PointCount;
+					Points[PointIdx] = ImVec2(500.0f + 400.0f * FMath::Cos(Angle), 500.0f + 400.0f * FMath::Sin(Angle));
+				}
+				else
+				{
+					Points[PointIdx] = ImVec2(PointIdx * 1000.0f / PointCount, 500.0f + 250.0f * FMath::Sin(PointIdx * 0.05f));
+				}
+			}
+
+			// Aim for roughly the same amount of work regardless of the point count
+			const int32 Iterations = FMath::Max(1, 2000000 / PointCount);
+
+			int64 VertexCount = 0;
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				ImGui_ResetBenchmarkDrawList(DrawList, Case.Flags);
+				if (Case.bFilled)
+				{
+					DrawList.AddConvexPolyFilled(Points.GetData(), PointCount, IM_COL32_WHITE);
+				}
+				else
+				{
+					DrawList.AddPolyline(Points.GetData(), PointCount, IM_COL32_WHITE, ImDrawFlags_None, Case.Thickness);
+				}
+
+				VertexCount += DrawList.VtxBuffer.Size;
+			}
+			const double ElapsedTime = FMath::Max(FPlatformTime::Seconds() - StartTime, UE_DOUBLE_SMALL_NUMBER);
+
+			Ar.Logf(TEXT("%-24s %6d points: %8.2f Mvtx/s (%.3f ms per call)"), Case.Name, PointCount, VertexCount / ElapsedTime / 1e6, ElapsedTime * 1e3 / Iterations);
+		}
+	}
+}
+
+static FAutoConsoleCommandWithOutputDevice GImGuiBenchmarkPolylineCommand(
+	TEXT("ImGui.Benchmark.Polyline"),
+	TEXT("Measures ImDrawList::AddPolyline and AddConvexPolyFilled throughput (vertices per second) for 10 to 100k points"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&ImGui_BenchmarkPolyline));
+
+static void ImGui_BenchmarkText(FOutputDevice& Ar)
+{
+	const ImGui::FScopedContext ScopedContext;
+	if (!ScopedContext)
+	{
+		Ar.Log(TEXT("ImGui context is not ready for drawing"));
+		return;
+	}
+
+	ImFont* Font = ImGui::GetFont();
+	const float FontSize = ImGui::GetFontSize();
+	const int32 PrevCacheCapacity = Font->LayoutCache ? Font->LayoutCache->Entries.Size : 0;
+
+	// Log view style content, every fourth line word-wrapped as in a details panel
+	static constexpr int32 LineCount = 5000;
+	static constexpr int32 FrameCount = 20;
+
+	TArray<ANSICHAR> TextBuffer;
+	TArray<int32> LineOffsets;
+	for (int32 LineIdx = 0; LineIdx < LineCount; ++LineIdx)
+	{
+		TAnsiStringBuilder<128> Line;
+		Line.Appendf("[%05d] LogBenchmark: Entity_%d updated state %d in %.3f ms", LineIdx, LineIdx * 7919 % 1000, LineIdx % 13, (LineIdx % 97) * 0.137f);
+		LineOffsets.Add(TextBuffer.Num());
+		TextBuffer.Append(Line.GetData(), Line.Len() + 1);
+	}
+
+	ImDrawList DrawList(ImGui::GetDrawListSharedData());
+
+	for (const int32 CacheCapacity : { 0, LineCount * 2 })
+	{
+		Font->SetLayoutCacheCapacity(CacheCapacity);
+
+		double TotalTime = 0.0;
+		for (int32 FrameIdx = 0; FrameIdx < FrameCount; ++FrameIdx)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+			ImGui_ResetBenchmarkDrawList(DrawList, ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill);
+			for (int32 LineIdx = 0; LineIdx < LineCount; ++LineIdx)
+			{
+				// Mimics ImGui::TextUnformatted/TextWrapped which measure the text before rendering it
+				const char* Text = TextBuffer.GetData() + LineOffsets[LineIdx];
+				const float WrapWidth = (LineIdx % 4 == 0) ? 200.0f : 0.0f;
+				const ImVec2 TextSize = Font->CalcTextSizeA(FontSize, FLT_MAX, WrapWidth, Text);
+				const ImVec2 TextPos(10.0f, 10.0f + (LineIdx % 64) * TextSize.y);
+				DrawList.AddText(Font, FontSize, TextPos, IM_COL32_WHITE, Text, nullptr, WrapWidth);
+			}
+			TotalTime += FPlatformTime::Seconds() - StartTime;
+		}
+
+		Ar.Logf(TEXT("Text %d lines, layout cache %s: %.3f ms per frame"), LineCount, CacheCapacity > 0 ? TEXT("on ") : TEXT("off"), TotalTime * 1e3 / FrameCount);
+	}
+
+	Font->SetLayoutCacheCapacity(PrevCacheCapacity);
+}
+
+static FAutoConsoleCommandWithOutputDevice GImGuiBenchmarkTextCommand(
+	TEXT("ImGui.Benchmark.Text"),
+	TEXT("Measures the per-frame cost of measuring and rendering 5k lines of text with and without the font layout cache"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&ImGui_BenchmarkText));
+
+static void ImGui_BenchmarkTextFilter(FOutputDevice& Ar)
+{
+	const ImGui::FScopedContext ScopedContext;
+	if (!ScopedContext)
+	{
+		Ar.Log(TEXT("ImGui context is not ready for drawing"));
+		return;
+	}
+
+	// Log console style content
+	static constexpr int32 LineCount = 500000;
+
+	TArray<ANSICHAR> TextBuffer;
+	TArray<int32> LineOffsets;
+	TextBuffer.Reserve(LineCount * 64);
+	for (int32 LineIdx = 0; LineIdx < LineCount; ++LineIdx)
+	{
+		TAnsiStringBuilder<128> Line;
+		Line.Appendf("[%06d] LogBenchmark: %s Entity_%d updated state %d in %.3f ms", LineIdx, (LineIdx % 50 == 0) ? "Warning:" : "", (LineIdx % 1000) * 7919 % 1000, LineIdx % 13, (LineIdx % 97) * 0.137f);
+		LineOffsets.Add(TextBuffer.Num());
+		TextBuffer.Append(Line.GetData(), Line.Len() + 1);
+	}
+	LineOffsets.Add(TextBuffer.Num());
+
+	const auto GetLine = [&TextBuffer, &LineOffsets](int32 LineIdx)
+	{
+		return FAnsiStringView(TextBuffer.GetData() + LineOffsets[LineIdx], LineOffsets[LineIdx + 1] - LineOffsets[LineIdx] - 1);
+	};
+
+	static const char* Queries[] = {
+		"warning",
+		"warning,entity_42,-state 1",
+		"warning,entity_42,entity_7,state 3,state 5,in 1.,in 2.,-state 12,-ms x,nothing"
+	};
+
+	for (const char* Query : Queries)
+	{
+		const ImGuiTextFilter Filter(Query);
+
+		int32 MatchCount = 0;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 LineIdx = 0; LineIdx < LineCount; ++LineIdx)
+		{
+			const FAnsiStringView Line = GetLine(LineIdx);
+			MatchCount += Filter.PassFilter(Line.GetData(), Line.GetData() + Line.Len()) ? 1 : 0;
+		}
+		const double ElapsedTime = FMath::Max(FPlatformTime::Seconds() - StartTime, UE_DOUBLE_SMALL_NUMBER);
+
+		Ar.Logf(TEXT("PassFilter %2d terms: %7.2f Mlines/s (%d matches)"), Filter.Filters.Size, LineCount / ElapsedTime / 1e6, MatchCount);
+	}
+
+	// Typing a query one character at a time, each step only rescans the previous matches
+	FImGuiFilteredLines FilteredLines(GetLine);
+	FilteredLines.AsyncLineThreshold = MAX_int32;
+
+	ImGuiTextFilter Filter;
+	for (const char* Query : { "e", "en", "ent", "enti", "entit", "entity_4", "entity_42", "entity_42,-state 1" })
+	{
+		FCStringAnsi::Strncpy(Filter.InputBuf, Query, UE_ARRAY_COUNT(Filter.InputBuf));
+		Filter.Build();
+
+		const double StartTime = FPlatformTime::Seconds();
+		FilteredLines.Update(Filter, LineCount);
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+		Ar.Logf(TEXT("Incremental %-20s %8.3f ms (%d matches)"), ANSI_TO_TCHAR(Query), ElapsedTime * 1e3, FilteredLines.Num());
+	}
+}
+
+static FAutoConsoleCommandWithOutputDevice GImGuiBenchmarkTextFilterCommand(
+	TEXT("ImGui.Benchmark.TextFilter"),
+	TEXT("Measures ImGuiTextFilter throughput (lines per second) over 500k lines for 1, 3 and 10 terms, and incremental narrowing while typing"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&ImGui_BenchmarkTextFilter));
+
+static void ImGui_BenchmarkPlotLine(FOutputDevice& Ar)
+{
+	const ImGui::FScopedContext ScopedContext;
+	if (!ScopedContext)
+	{
+		Ar.Log(TEXT("ImGui context is not ready for drawing"));
+		return;
+	}
+
+	struct FPlotLineCase
+	{
+		const TCHAR* Name;
+		ImPlotLineFlags Flags;
+		int32 MaxPointCount;
+	};
+
+	// Rendering every point is only measured for the smallest series, 10M points would already need several GB of vertices
+	static const FPlotLineCase Cases[] = {
+		{ TEXT("min/max"), ImPlotLineFlags_None, MAX_int32 },
+		{ TEXT("LTTB"), ImPlotLineFlags_DownsampleLTTB, MAX_int32 },
+		{ TEXT("full"), ImPlotLineFlags_NoDownsample, 1000000 }
+	};
+
+	static const int32 PointCounts[] = { 1000000, 10000000, 100000000 };
+
+	// Frame time style trace: slow wave, noise and isolated spikes
+	TArray<float> Values;
+	Values.SetNumUninitialized(PointCounts[UE_ARRAY_COUNT(PointCounts) - 1]);
+	FRandomStream Random(0);
+	for (int32 ValueIdx = 0; ValueIdx < Values.Num(); ++ValueIdx)
+	{
+		Values[ValueIdx] = 16.0f + 2.0f * FMath::Sin(ValueIdx * 1e-5f) + Random.GetFraction() + (ValueIdx % 99991 == 0 ? 20.0f : 0.0f);
+	}
+
+	const ImGuiViewport* Viewport = ImGui::GetMainViewport();
+	ImGui::SetNextWindowPos(Viewport->WorkPos);
+	ImGui::SetNextWindowSize(Viewport->WorkSize);
+	ImGui::Begin("ImGui.Benchmark.PlotLine", nullptr, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoFocusOnAppearing);
+	const ImVec2 PlotPos = ImGui::GetCursorPos();
+	ImDrawList* DrawList = ImGui::GetWindowDrawList();
+
+	for (const int32 PointCount : PointCounts)
+	{
+		for (const FPlotLineCase& Case : Cases)
+		{
+			if (PointCount > Case.MaxPointCount)
+			{
+				continue;
+			}
+
+			// Plots are stacked on top of each other so they all get the same width
+			ImGui::SetCursorPos(PlotPos);
+			ImGui::PushID(&Case);
+			ImGui::PushID(PointCount);
+
+			const int32 PrevVertexCount = DrawList->VtxBuffer.Size;
+			const double StartTime = FPlatformTime::Seconds();
+			if (ImPlot::BeginPlot("##Benchmark", ImVec2(-1.0f, -1.0f)))
+			{
+				ImPlot::SetupAxesLimits(0.0, PointCount, 0.0, 40.0, ImPlotCond_Always);
+				ImPlot::PlotLine("Frame Time", Values.GetData(), PointCount, 1.0, 0.0, Case.Flags);
+				ImPlot::EndPlot();
+			}
+			const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+			ImGui::PopID();
+			ImGui::PopID();
+
+			Ar.Logf(TEXT("PlotLine %9d points, %-7s: %8.2f ms per frame (%d vertices)"), PointCount, Case.Name, ElapsedTime * 1e3, DrawList->VtxBuffer.Size - PrevVertexCount);
+		}
+	}
+
+	ImGui::End();
+}
+
+static FAutoConsoleCommandWithOutputDevice GImGuiBenchmarkPlotLineCommand(
+	TEXT("ImGui.Benchmark.PlotLine"),
+	TEXT("Measures the cost of ImPlot::PlotLine for 1M, 10M and 100M points with min/max and LTTB downsampling, and without for 1M points"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&ImGui_BenchmarkPlotLine));
+
+static void ImGui_BenchmarkPlotSeries(FOutputDevice& Ar)
+{
+	const ImGui::FScopedContext ScopedContext;
+	if (!ScopedContext)
+	{
+		Ar.Log(TEXT("ImGui context is not ready for drawing"));
+		return;
+	}
+
+	struct FPlotSeriesCase
+	{
+		const TCHAR* Name;
+		double ViewMin;
+		double ViewMax;
+	};
+
+	constexpr int32 PointCount = 10000000;
+
+	// An empty view auto-fits the axes
+	static const FPlotSeriesCase Cases[] = {
+		{ TEXT("auto-fit"), 0.0, 0.0 },
+		{ TEXT("all"), 0.0, PointCount },
+		{ TEXT("zoom 1%"), 0.5 * PointCount, 0.51 * PointCount },
+		{ TEXT("zoom 0.1%"), 0.5 * PointCount, 0.501 * PointCount }
+	};
+
+	TArray<double> Values;
+	Values.SetNumUninitialized(PointCount);
+	FRandomStream Random(0);
+	for (int32 ValueIdx = 0; ValueIdx < Values.Num(); ++ValueIdx)
+	{
+		Values[ValueIdx] = 16.0 + 2.0 * FMath::Sin(ValueIdx * 1e-5) + Random.GetFraction() + (ValueIdx % 99991 == 0 ? 20.0 : 0.0);
+	}
+
+	double StartTime = FPlatformTime::Seconds();
+	ImPlotSeries Series;
+	Series.SetData(Values.GetData(), Values.Num());
+	Ar.Logf(TEXT("PlotSeries build %d points: %.2f ms"), PointCount, (FPlatformTime::Seconds() - StartTime) * 1e3);
+
+	const ImGuiViewport* Viewport = ImGui::GetMainViewport();
+	ImGui::SetNextWindowPos(Viewport->WorkPos);
+	ImGui::SetNextWindowSize(Viewport->WorkSize);
+	ImGui::Begin("ImGui.Benchmark.PlotSeries", nullptr, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoFocusOnAppearing);
+	const ImVec2 PlotPos = ImGui::GetCursorPos();
+
+	for (const FPlotSeriesCase& Case : Cases)
+	{
+		for (const bool bCached : { false, true })
+		{
+			ImGui::SetCursorPos(PlotPos);
+			ImGui::PushID(&Case);
+			ImGui::PushID(bCached);
+
+			StartTime = FPlatformTime::Seconds();
+			if (ImPlot::BeginPlot("##Benchmark", ImVec2(-1.0f, -1.0f)))
+			{
+				if (Case.ViewMin < Case.ViewMax)
+				{
+					ImPlot::SetupAxesLimits(Case.ViewMin, Case.ViewMax, 0.0, 40.0, ImPlotCond_Always);
+				}
+				else
+				{
+					ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+				}
+
+				if (bCached)
+				{
+					ImPlot::PlotLine("Frame Time", Series);
+				}
+				else
+				{
+					ImPlot::PlotLine("Frame Time", Values.GetData(), Values.Num());
+				}
+				ImPlot::EndPlot();
+			}
+			const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+			ImGui::PopID();
+			ImGui::PopID();
+
+			Ar.Logf(TEXT("PlotLine %d points, %-9s %-6s: %8.3f ms per frame"), PointCount, Case.Name, bCached ? TEXT("series") : TEXT("array"), ElapsedTime * 1e3);
+		}
+	}
+
+	ImGui::End();
+}
+
+static FAutoConsoleCommandWithOutputDevice GImGuiBenchmarkPlotSeriesCommand(
+	TEXT("ImGui.Benchmark.PlotSeries"),
+	TEXT("Compares ImPlot::PlotLine of 10M points from an array and from an ImPlotSeries, auto-fitting and zoomed into 1% and 0.1% of the data"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&ImGui_BenchmarkPlotSeries));
+
+static void ImGui_BenchmarkPlotHeatmap(FOutputDevice& Ar)
+{
+	const ImGui::FScopedContext ScopedContext;
+	if (!ScopedContext)
+	{
+		Ar.Log(TEXT("ImGui context is not ready for drawing"));
+		return;
+	}
+
+	constexpr int32 Size = 1024;
+
+	// Spatial density style grid
+	TArray<float> Values;
+	Values.SetNumUninitialized(Size * Size);
+	FRandomStream Random(0);
+	for (int32 ValueIdx = 0; ValueIdx < Values.Num(); ++ValueIdx)
+	{
+		const float X = (ValueIdx % Size) / static_cast<float>(Size) - 0.5f;
+		const float Y = (ValueIdx / Size) / static_cast<float>(Size) - 0.5f;
+		Values[ValueIdx] = FMath::Exp(-10.0f * (X * X + Y * Y)) + 0.1f * Random.GetFraction();
+	}
+
+	FImGuiPlotHeatmap Heatmap;
+
+	const ImGuiViewport* Viewport = ImGui::GetMainViewport();
+	ImGui::SetNextWindowPos(Viewport->WorkPos);
+	ImGui::SetNextWindowSize(Viewport->WorkSize);
+	ImGui::Begin("ImGui.Benchmark.PlotHeatmap", nullptr, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoFocusOnAppearing);
+	const ImVec2 PlotPos = ImGui::GetCursorPos();
+	ImDrawList* DrawList = ImGui::GetWindowDrawList();
+
+	// The texture is updated on the first frame and reused on the second
+	static const TCHAR* CaseNames[] = { TEXT("PlotHeatmap"), TEXT("texture update"), TEXT("texture cached") };
+	for (int32 CaseIdx = 0; CaseIdx < UE_ARRAY_COUNT(CaseNames); ++CaseIdx)
+	{
+		ImGui::SetCursorPos(PlotPos);
+		ImGui::PushID(CaseIdx);
+
+		const int32 PrevVertexCount = DrawList->VtxBuffer.Size;
+		const double StartTime = FPlatformTime::Seconds();
+		if (ImPlot::BeginPlot("##Benchmark", ImVec2(-1.0f, -1.0f)))
+		{
+			ImPlot::SetupAxesLimits(0.0, 1.0, 0.0, 1.0, ImPlotCond_Always);
+			if (CaseIdx == 0)
+			{
+				ImPlot::PlotHeatmap("Density", Values.GetData(), Size, Size);
+			}
+			else
+			{
+				Heatmap.Plot("Density", Values.GetData(), Size, Size);
+			}
+			ImPlot::EndPlot();
+		}
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+		ImGui::PopID();
+
+		Ar.Logf(TEXT("%dx%d heatmap, %-14s: %8.2f ms per frame (%d vertices)"), Size, Size, CaseNames[CaseIdx], ElapsedTime * 1e3, DrawList->VtxBuffer.Size - PrevVertexCount);
+	}
+
+	ImGui::End();
+}
+
+static FAutoConsoleCommandWithOutputDevice GImGuiBenchmarkPlotHeatmapCommand(
+	TEXT("ImGui.Benchmark.PlotHeatmap"),
+	TEXT("Compares ImPlot::PlotHeatmap of 1024x1024 cells with FImGuiPlotHeatmap, when updating its texture and when reusing it"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&ImGui_BenchmarkPlotHeatmap));
+
+static void ImGui_BenchmarkPlotHistogram(FOutputDevice& Ar)
+{
+	const ImGui::FScopedContext ScopedContext;
+	if (!ScopedContext)
+	{
+		Ar.Log(TEXT("ImGui context is not ready for drawing"));
+		return;
+	}
+
+	struct FPlotHistogramCase
+	{
+		const TCHAR* Name;
+		bool bParallel;
+		ImPlotHistogramFlags Flags;
+	};
+
+	// The parallel case fills the cache reused by the cached case
+	static const FPlotHistogramCase Cases[] = {
+		{ TEXT("serial"), false, ImPlotHistogramFlags_None },
+		{ TEXT("parallel"), true, ImPlotHistogramFlags_Cache },
+		{ TEXT("cached"), true, ImPlotHistogramFlags_Cache }
+	};
+
+	constexpr int32 SampleCount = 5000000;
+	constexpr int32 Bins = 100;
+
+	// Normally distributed samples through the Box-Muller transform
+	TArray<double> Xs;
+	TArray<double> Ys;
+	Xs.SetNumUninitialized(SampleCount);
+	Ys.SetNumUninitialized(SampleCount);
+	FRandomStream Random(0);
+	for (int32 SampleIdx = 0; SampleIdx < SampleCount; ++SampleIdx)
+	{
+		const double Radius = FMath::Sqrt(-2.0 * FMath::Loge(1.0 - Random.GetFraction()));
+		const double Angle = 2.0 * PI * Random.GetFraction();
+		Xs[SampleIdx] = Radius * FMath::Cos(Angle);
+		Ys[SampleIdx] = Radius * FMath::Sin(Angle);
+	}
+
+	const ImPlotParallelFor ParallelFor = GImPlot->ParallelFor;
+
+	const ImGuiViewport* Viewport = ImGui::GetMainViewport();
+	ImGui::SetNextWindowPos(Viewport->WorkPos);
+	ImGui::SetNextWindowSize(Viewport->WorkSize);
+	ImGui::Begin("ImGui.Benchmark.PlotHistogram", nullptr, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoFocusOnAppearing);
+	const ImVec2 PlotPos = ImGui::GetCursorPos();
+
+	for (int32 Dimensions = 1; Dimensions <= 2; ++Dimensions)
+	{
+		for (const FPlotHistogramCase& Case : Cases)
+		{
+			ImGui::SetCursorPos(PlotPos);
+			ImGui::PushID(&Case);
+			ImGui::PushID(Dimensions);
+			ImPlot::SetParallelFor(Case.bParallel ? ParallelFor : nullptr);
+
+			const double StartTime = FPlatformTime::Seconds();
+			if (ImPlot::BeginPlot("##Benchmark", ImVec2(-1.0f, -1.0f)))
+			{
+				if (Dimensions == 1)
+				{
+					ImPlot::PlotHistogram("Samples", Xs.GetData(), SampleCount, Bins, 1.0, ImPlotRange(), Case.Flags);
+				}
+				else
+				{
+					ImPlot::PlotHistogram2D("Samples", Xs.GetData(), Ys.GetData(), SampleCount, Bins, Bins, ImPlotRect(), Case.Flags);
+				}
+				ImPlot::EndPlot();
+			}
+			const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+			ImGui::PopID();
+			ImGui::PopID();
+
+			Ar.Logf(TEXT("PlotHistogram%s %d samples, %-8s: %8.2f ms per frame (%.1f M samples/s)"), Dimensions == 1 ? TEXT("  ") : TEXT("2D"), SampleCount, Case.Name,
+				ElapsedTime * 1e3, SampleCount / ElapsedTime * 1e-6);
+		}
+	}
+
+	ImPlot::SetParallelFor(ParallelFor);
+
+	ImGui::End();
+}
+
+static FAutoConsoleCommandWithOutputDevice GImGuiBenchmarkPlotHistogramCommand(
+	TEXT("ImGui.Benchmark.PlotHistogram"),
+	TEXT("Measures the throughput of ImPlot::PlotHistogram and ImPlot::PlotHistogram2D for 5M samples into 100 bins per axis, binned serially, in parallel and cached"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&ImGui_BenchmarkPlotHistogram));
+
+static void ImGui_BenchmarkPlotScatter(FOutputDevice& Ar)
+{
+	const ImGui::FScopedContext ScopedContext;
+	if (!ScopedContext)
+	{
+		Ar.Log(TEXT("ImGui context is not ready for drawing"));
+		return;
+	}
+
+	struct FPlotScatterCase
+	{
+		const TCHAR* Name;
+		bool bSprites;
+		int32 MaxPointCount;
+	};
+
+	// Tessellated markers are only measured up to 1M points, 5M points would need several GB of vertices
+	static const FPlotScatterCase Cases[] = {
+		{ TEXT("sprites"), true, MAX_int32 },
+		{ TEXT("tessellated"), false, 1000000 }
+	};
+
+	static const int32 PointCounts[] = { 100000, 1000000, 5000000 };
+
+	// Gaussian cloud with most points inside the plot and some culled outside of it
+	TArray<float> Xs;
+	TArray<float> Ys;
+	Xs.SetNumUninitialized(PointCounts[UE_ARRAY_COUNT(PointCounts) - 1]);
+	Ys.SetNumUninitialized(PointCounts[UE_ARRAY_COUNT(PointCounts) - 1]);
+	FRandomStream Random(0);
+	for (int32 PointIdx = 0; PointIdx < Xs.Num(); ++PointIdx)
+	{
+		const float Radius = FMath::Sqrt(-2.0f * FMath::Loge(1.0f - Random.GetFraction()));
+		const float Angle = 2.0f * PI * Random.GetFraction();
+		Xs[PointIdx] = Radius * FMath::Cos(Angle);
+		Ys[PointIdx] = Radius * FMath::Sin(Angle);
+	}
+
+	ImPlotMarkerSprites& MarkerSprites = GImPlot->MarkerSprites;
+	const bool bSpritesReady = MarkerSprites.Ready;
+	if (!bSpritesReady)
+	{
+		Ar.Log(TEXT("Marker sprites are not in the font atlas, both cases are tessellated"));
+	}
+
+	const ImGuiViewport* Viewport = ImGui::GetMainViewport();
+	ImGui::SetNextWindowPos(Viewport->WorkPos);
+	ImGui::SetNextWindowSize(Viewport->WorkSize);
+	ImGui::Begin("ImGui.Benchmark.PlotScatter", nullptr, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoFocusOnAppearing);
+	const ImVec2 PlotPos = ImGui::GetCursorPos();
+	ImDrawList* DrawList = ImGui::GetWindowDrawList();
+
+	for (const int32 PointCount : PointCounts)
+	{
+		for (const FPlotScatterCase& Case : Cases)
+		{
+			if (PointCount > Case.MaxPointCount)
+			{
+				continue;
+			}
+
+			ImGui::SetCursorPos(PlotPos);
+			ImGui::PushID(&Case);
+			ImGui::PushID(PointCount);
+			MarkerSprites.Ready = bSpritesReady && Case.bSprites;
+
+			const int32 PrevVertexCount = DrawList->VtxBuffer.Size;
+			const double StartTime = FPlatformTime::Seconds();
+			if (ImPlot::BeginPlot("##Benchmark", ImVec2(-1.0f, -1.0f)))
+			{
+				ImPlot::SetupAxesLimits(-3.0, 3.0, -3.0, 3.0, ImPlotCond_Always);
+				ImPlot::PlotScatter("Samples", Xs.GetData(), Ys.GetData(), PointCount);
+				ImPlot::EndPlot();
+			}
+			const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+			ImGui::PopID();
+			ImGui::PopID();
+
+			Ar.Logf(TEXT("PlotScatter %8d points, %-11s: %8.2f ms per frame (%d vertices)"), PointCount, Case.Name, ElapsedTime * 1e3, DrawList->VtxBuffer.Size - PrevVertexCount);
+		}
+	}
+
+	MarkerSprites.Ready = bSpritesReady;
+
+	ImGui::End();
+}
+
+static FAutoConsoleCommandWithOutputDevice GImGuiBenchmarkPlotScatterCommand(
+	TEXT("ImGui.Benchmark.PlotScatter"),
+	TEXT("Compares ImPlot::PlotScatter of 100k, 1M and 5M points drawn from the marker sprites of the font atlas with tessellated markers"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&ImGui_BenchmarkPlotScatter));
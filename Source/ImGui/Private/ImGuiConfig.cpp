@@ -22,6 +22,7 @@ THIRD_PARTY_INCLUDES_END
 
 #include "ImGuiContext.h"
 #include "ImGuiModule.h"
+#include "ImGuiStats.h"
 
 #ifdef IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS
 ImFileHandle ImFileOpen(const char* FileName, const char* Mode)
@@ -117,33 +118,92 @@ uint64 ImFileWrite(const void* Data, uint64 Size, uint64 Count, ImFileHandle Fil
 }
 #endif
 
+/// Session contexts resolved by default scoped contexts, indexed by PIE instance + 1 and owned by the module
+static TArray<FImGuiContext*, TInlineAllocator<8>> GImGui_SessionContextCache;
+
+/// Session generation of the module the cache was filled at
+static uint32 GImGui_SessionContextCacheGeneration = 0;
+
+static FImGuiContext* ImGui_FindSessionContext(const int32 PIEInstance)
+{
+	FImGuiModule& Module = FImGuiModule::Get();
+	const int32 CacheIdx = PIEInstance + 1;
+	if (!IsInGameThread() || CacheIdx < 0)
+	{
+		return Module.FindOrCreateSessionContext(PIEInstance).Get();
+	}
+
+	if (GImGui_SessionContextCacheGeneration != Module.GetSessionGeneration())
+	{
+		GImGui_SessionContextCache.Reset();
+		GImGui_SessionContextCacheGeneration = Module.GetSessionGeneration();
+	}
+
+	if (GImGui_SessionContextCache.IsValidIndex(CacheIdx) && GImGui_SessionContextCache[CacheIdx])
+	{
+		return GImGui_SessionContextCache[CacheIdx];
+	}
+
+	// Contexts which failed to be created aren't cached so they are retried like before
+	FImGuiContext* Context = Module.FindOrCreateSessionContext(PIEInstance).Get();
+	if (Context)
+	{
+		if (GImGui_SessionContextCache.Num() <= CacheIdx)
+		{
+			GImGui_SessionContextCache.SetNumZeroed(CacheIdx + 1);
+		}
+		GImGui_SessionContextCache[CacheIdx] = Context;
+	}
+
+	return Context;
+}
+
 ImGui::FScopedContext::FScopedContext(const int32 PIEInstance)
-	: FScopedContext(FImGuiModule::Get().FindOrCreateSessionContext(PIEInstance))
+	: Context(ImGui_FindSessionContext(PIEInstance))
 {
+	Activate();
+
+	// Session contexts are scoped by widget code, time it for "stat ImGui" and the ImGui trace channel
+	ImGuiStats::BeginWidgets();
+	bTimesWidgets = true;
 }
 
 ImGui::FScopedContext::FScopedContext(const TSharedPtr<FImGuiContext>& InContext)
-	: Context(InContext)
+	: Context(InContext.Get())
+	, ContextRef(InContext)
+{
+	Activate();
+}
+
+void ImGui::FScopedContext::Activate()
 {
 	PrevContext = GetCurrentContext();
-	PrevPlotContext = ImPlot::GetCurrentContext();
 
-	if (Context.IsValid())
-	{
-		SetCurrentContext(*Context);
-		ImPlot::SetCurrentContext(*Context);
-	}
-	else
+	ImGuiContext* NewContext = Context ? static_cast<ImGuiContext*>(*Context) : nullptr;
+	if (NewContext == PrevContext)
 	{
-		SetCurrentContext(nullptr);
-		ImPlot::SetCurrentContext(nullptr);
+		// Nested in a scope of the same context, nothing to switch or restore
+		return;
 	}
+
+	PrevPlotContext = ImPlot::GetCurrentContext();
+	SetCurrentContext(NewContext);
+	ImPlot::SetCurrentContext(Context ? static_cast<ImPlotContext*>(*Context) : nullptr);
+	bRestoresContext = true;
 }
 
 ImGui::FScopedContext::~FScopedContext()
 {
-	SetCurrentContext(PrevContext);
-	ImPlot::SetCurrentContext(PrevPlotContext);
+	if (bTimesWidgets)
+	{
+		ImGuiStats::EndWidgets();
+	}
+
+	if (bRestoresContext)
+	{
+		SetCurrentContext(PrevContext);
+		ImPlot::SetCurrentContext(PrevPlotContext);
+	}
 }
 
 ImGui::FScopedContext::operator bool() const
@@ -154,12 +214,12 @@ ImGui::FScopedContext::operator bool() const
 
 bool ImGui::FScopedContext::IsValid() const
 {
-	return Context.IsValid();
+	return Context != nullptr;
 }
 
 FImGuiContext* ImGui::FScopedContext::operator->() const
 {
-	return Context.operator->();
+	return Context;
 }
 
 ImGuiKey ImGui::ConvertKey(const FKey& Key)
@@ -1,22 +1,26 @@
 #include "ImGuiContext.h"
 
+#include <Async/ParallelFor.h>
 #include <Framework/Application/SlateApplication.h>
-#include <HAL/LowLevelMemTracker.h>
-#include <HAL/UnrealMemory.h>
 #include <Widgets/SWindow.h>
 
-#if WITH_ENGINE
-#include <TextureResource.h>
-#endif
+#include "ImGuiStats.h"
+
+// Draw frame conversion and compression are timed, sent bytes are counted from NetImgui's com thread
+#define NETIMGUI_PROFILE_SCOPE(Name) IMGUI_SCOPE_CYCLE_COUNTER(NetImgui##Name)
+#define NETIMGUI_PROFILE_DATA_SENT(Size) IMGUI_INC_COUNTER(NetImguiBytesSent, Size)
 
 THIRD_PARTY_INCLUDES_START
 #include <imgui.h>
 #include <imgui_internal.h>
-#include <implot.h>
+#include <implot_internal.h>
 #define NETIMGUI_IMPLEMENTATION
 #include <NetImGui_Api.h>
 THIRD_PARTY_INCLUDES_END
 
+#include "ImGuiDeferred.h"
+#include "ImGuiFontAtlas.h"
+#include "ImGuiRenderTarget.h"
 #include "SImGuiOverlay.h"
 
 FImGuiViewportData* FImGuiViewportData::GetOrCreate(ImGuiViewport* Viewport)
@@ -36,15 +40,43 @@ FImGuiViewportData* FImGuiViewportData::GetOrCreate(ImGuiViewport* Viewport)
 	return ViewportData;
 }
 
-static void* ImGui_MemAlloc(size_t Size, void* UserData)
+void FImGuiViewportData::Refresh()
 {
-	LLM_SCOPE_BYNAME(TEXT("ImGui"));
-	return FMemory::Malloc(Size);
+	Pos = FVector2f::ZeroVector;
+	Size = FVector2f::ZeroVector;
+
+	if (const TSharedPtr<SImGuiOverlay> OverlayPtr = Overlay.Pin())
+	{
+		const FGeometry& Geometry = OverlayPtr->GetTickSpaceGeometry();
+		Pos = Geometry.GetAbsolutePosition();
+		Size = Geometry.GetAbsoluteSize();
+	}
+#if WITH_ENGINE
+	else if (const TSharedPtr<FImGuiRenderTarget> RenderTargetPtr = RenderTarget.Pin())
+	{
+		Size = RenderTargetPtr->GetSize();
+	}
+#endif
+
+	bFocused = false;
+	bMinimized = false;
+	bHidden = false;
+
+	if (const TSharedPtr<SWindow> WindowPtr = Window.Pin())
+	{
+		bMinimized = WindowPtr->IsWindowMinimized();
+		bHidden = !WindowPtr->IsVisible();
+
+		if (const TSharedPtr<FGenericWindow> NativeWindow = WindowPtr->GetNativeWindow())
+		{
+			bFocused = NativeWindow->IsForegroundWindow();
+		}
+	}
 }
 
-static void ImGui_MemFree(void* Ptr, void* UserData)
+static void ImGui_PlotParallelFor(int Count, void (*Func)(int Index, void* UserData), void* UserData)
 {
-	FMemory::Free(Ptr);
+	ParallelFor(Count, [Func, UserData](int32 Index) { Func(Index, UserData); });
 }
 
 static void ImGui_CreateWindow(ImGuiViewport* Viewport)
@@ -91,6 +123,10 @@ static void ImGui_CreateWindow(ImGuiViewport* Viewport)
 				.Context(FImGuiContext::Get(ImGui::GetCurrentContext()))
 			];
 
+		// The overlay has no geometry until the window is first painted
+		ViewportData->Pos = Viewport->Pos;
+		ViewportData->Size = Viewport->Size;
+
 		if (ParentWindow.IsValid())
 		{
 			FSlateApplication::Get().AddWindowAsNativeChild(Window, ParentWindow.ToSharedRef());
@@ -134,12 +170,13 @@ static void ImGui_ShowWindow(ImGuiViewport* Viewport)
 
 static void ImGui_SetWindowPos(ImGuiViewport* Viewport, ImVec2 Pos)
 {
-	const FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(Viewport);
+	FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(Viewport);
 	if (ViewportData)
 	{
 		if (const TSharedPtr<SWindow> Window = ViewportData->Window.Pin())
 		{
 			Window->MoveWindowTo(FVector2f(Pos));
+			ViewportData->Pos = Pos;
 		}
 	}
 }
@@ -147,25 +184,18 @@ static void ImGui_SetWindowPos(ImGuiViewport* Viewport, ImVec2 Pos)
 static ImVec2 ImGui_GetWindowPos(ImGuiViewport* Viewport)
 {
 	const FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(Viewport);
-	if (ViewportData)
-	{
-		if (const TSharedPtr<SImGuiOverlay> Overlay = ViewportData->Overlay.Pin())
-		{
-			return Overlay->GetTickSpaceGeometry().GetAbsolutePosition();
-		}
-	}
-
-	return FVector2f::ZeroVector;
+	return ViewportData ? ViewportData->Pos : FVector2f::ZeroVector;
 }
 
 static void ImGui_SetWindowSize(ImGuiViewport* Viewport, ImVec2 Size)
 {
-	const FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(Viewport);
+	FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(Viewport);
 	if (ViewportData)
 	{
 		if (const TSharedPtr<SWindow> Window = ViewportData->Window.Pin())
 		{
 			Window->Resize(FVector2f(Size));
+			ViewportData->Size = Size;
 		}
 	}
 }
@@ -173,20 +203,12 @@ static void ImGui_SetWindowSize(ImGuiViewport* Viewport, ImVec2 Size)
 static ImVec2 ImGui_GetWindowSize(ImGuiViewport* Viewport)
 {
 	const FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(Viewport);
-	if (ViewportData)
-	{
-		if (const TSharedPtr<SImGuiOverlay> Overlay = ViewportData->Overlay.Pin())
-		{
-			return Overlay->GetTickSpaceGeometry().GetAbsoluteSize();
-		}
-	}
-
-	return FVector2f::ZeroVector;
+	return ViewportData ? ViewportData->Size : FVector2f::ZeroVector;
 }
 
 static void ImGui_SetWindowFocus(ImGuiViewport* Viewport)
 {
-	const FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(Viewport);
+	FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(Viewport);
 	if (ViewportData)
 	{
 		if (const TSharedPtr<SWindow> Window = ViewportData->Window.Pin())
@@ -195,6 +217,7 @@ static void ImGui_SetWindowFocus(ImGuiViewport* Viewport)
 			{
 				NativeWindow->BringToFront();
 				NativeWindow->SetWindowFocus();
+				ViewportData->bFocused = true;
 			}
 		}
 	}
@@ -203,32 +226,13 @@ static void ImGui_SetWindowFocus(ImGuiViewport* Viewport)
 static bool ImGui_GetWindowFocus(ImGuiViewport* Viewport)
 {
 	const FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(Viewport);
-	if (ViewportData)
-	{
-		if (const TSharedPtr<SWindow> Window = ViewportData->Window.Pin())
-		{
-			if (const TSharedPtr<FGenericWindow> NativeWindow = Window->GetNativeWindow())
-			{
-				return NativeWindow->IsForegroundWindow();
-			}
-		}
-	}
-
-	return false;
+	return ViewportData && ViewportData->bFocused;
 }
 
 static bool ImGui_GetWindowMinimized(ImGuiViewport* Viewport)
 {
 	const FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(Viewport);
-	if (ViewportData)
-	{
-		if (const TSharedPtr<SWindow> Window = ViewportData->Window.Pin())
-		{
-			return Window->IsWindowMinimized();
-		}
-	}
-
-	return false;
+	return ViewportData && ViewportData->bMinimized;
 }
 
 static void ImGui_SetWindowTitle(ImGuiViewport* Viewport, const char* TitleAnsi)
@@ -260,16 +264,177 @@ static void ImGui_RenderWindow(ImGuiViewport* Viewport, void* Data)
 	const FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(Viewport);
 	if (ViewportData)
 	{
+		// Minimized and hidden windows aren't painted, their overlays keep the last draw data until shown again
+		if (ViewportData->bMinimized || ViewportData->bHidden)
+		{
+			return;
+		}
+
 		if (const TSharedPtr<SImGuiOverlay> Overlay = ViewportData->Overlay.Pin())
 		{
 			Overlay->SetDrawData(Viewport->DrawData);
 		}
+
+#if WITH_ENGINE
+		if (const TSharedPtr<FImGuiRenderTarget> RenderTarget = ViewportData->RenderTarget.Pin())
+		{
+			RenderTarget->SetDrawData(Viewport->DrawData);
+		}
+#endif
+	}
+}
+
+template <typename T>
+static int64 ImGui_GetBytes(const ImVector<T>& Vector)
+{
+	return static_cast<int64>(Vector.Capacity) * sizeof(T);
+}
+
+template <typename T>
+static int64 ImGui_GetBytes(const ImPool<T>& Pool)
+{
+	return ImGui_GetBytes(Pool.Buf) + ImGui_GetBytes(Pool.Map.Data);
+}
+
+static int64 ImGui_GetBytes(const ImGuiTextBuffer& Buffer)
+{
+	return ImGui_GetBytes(Buffer.Buf);
+}
+
+static int64 ImGui_GetBytes(const ImDrawListSplitter& Splitter)
+{
+	int64 Bytes = ImGui_GetBytes(Splitter._Channels);
+	for (const ImDrawChannel& Channel : Splitter._Channels)
+	{
+		Bytes += ImGui_GetBytes(Channel._CmdBuffer) + ImGui_GetBytes(Channel._IdxBuffer);
+	}
+
+	return Bytes;
+}
+
+static int64 ImGui_GetBytes(const ImDrawList& DrawList)
+{
+	return ImGui_GetBytes(DrawList.CmdBuffer) + ImGui_GetBytes(DrawList.IdxBuffer) + ImGui_GetBytes(DrawList.VtxBuffer) +
+		ImGui_GetBytes(DrawList._Path) + ImGui_GetBytes(DrawList._ClipRectStack) + ImGui_GetBytes(DrawList._TextureIdStack) +
+		ImGui_GetBytes(DrawList._Splitter);
+}
+
+static int64 ImGui_GetBytes(const ImPlotItemGroup& Items)
+{
+	return ImGui_GetBytes(Items.ItemPool) + ImGui_GetBytes(Items.Legend.Indices) + ImGui_GetBytes(Items.Legend.Labels);
+}
+
+static int64 ImGui_GetBytes(const ImPlotTicker& Ticker)
+{
+	return ImGui_GetBytes(Ticker.Ticks) + ImGui_GetBytes(Ticker.TextBuffer);
+}
+
+static FImGuiMemoryStats ImGui_GetMemoryStats(ImGuiContext& G, ImPlotContext& GP)
+{
+	FImGuiMemoryStats Stats;
+
+	for (const ImGuiWindow* Window : G.Windows)
+	{
+		Stats.DrawLists += ImGui_GetBytes(Window->DrawListInst);
+		Stats.Storage += sizeof(ImGuiWindow) + ImGui_GetBytes(Window->StateStorage.Data) + ImGui_GetBytes(Window->IDStack) + ImGui_GetBytes(Window->ColumnsStorage);
+
+		for (const ImGuiOldColumns& Columns : Window->ColumnsStorage)
+		{
+			Stats.Storage += ImGui_GetBytes(Columns.Columns) + ImGui_GetBytes(Columns.Splitter);
+		}
+	}
+
+	for (const ImGuiViewportP* Viewport : G.Viewports)
+	{
+		for (const ImDrawList* DrawList : Viewport->BgFgDrawLists)
+		{
+			Stats.DrawLists += DrawList ? ImGui_GetBytes(*DrawList) : 0;
+		}
+
+		Stats.DrawLists += ImGui_GetBytes(Viewport->DrawDataP.CmdLists) + ImGui_GetBytes(Viewport->DrawDataBuilder.LayerData1);
+	}
+
+	Stats.Storage += ImGui_GetBytes(G.Windows) + ImGui_GetBytes(G.WindowsById.Data) + ImGui_GetBytes(G.SettingsWindows.Buf) + ImGui_GetBytes(G.SettingsTables.Buf);
+
+	for (int32 TableIdx = 0; TableIdx < G.Tables.GetMapSize(); ++TableIdx)
+	{
+		if (const ImGuiTable* Table = G.Tables.TryGetMapData(TableIdx))
+		{
+			// Columns, their display order and the cells of the current row are a single allocation
+			if (Table->RawData)
+			{
+				Stats.Tables += Table->ColumnsCount * (sizeof(ImGuiTableColumn) + sizeof(ImGuiTableColumnIdx) + sizeof(ImGuiTableCellData));
+			}
+
+			Stats.Tables += ImGui_GetBytes(Table->ColumnsNames) + ImGui_GetBytes(Table->InstanceDataExtra) + ImGui_GetBytes(Table->SortSpecsMulti);
+		}
+	}
+
+	for (const ImGuiTableTempData& TempData : G.TablesTempData)
+	{
+		Stats.Tables += ImGui_GetBytes(TempData.DrawSplitter);
+	}
+
+	Stats.Tables += ImGui_GetBytes(G.Tables) + ImGui_GetBytes(G.TablesLastTimeActive) + ImGui_GetBytes(G.TablesTempData);
+
+	Stats.TextBuffers += ImGui_GetBytes(G.InputTextState.TextW) + ImGui_GetBytes(G.InputTextState.TextA) + ImGui_GetBytes(G.InputTextState.InitialTextA);
+	Stats.TextBuffers += ImGui_GetBytes(G.InputTextDeactivatedState.TextA) + ImGui_GetBytes(G.ClipboardHandlerData) + ImGui_GetBytes(G.LogBuffer);
+	Stats.TextBuffers += ImGui_GetBytes(G.SettingsIniData) + ImGui_GetBytes(G.DebugLogBuf) + ImGui_GetBytes(G.DebugLogIndex.LineOffsets) + ImGui_GetBytes(G.TempBuffer);
+
+	for (int32 PlotIdx = 0; PlotIdx < GP.Plots.GetMapSize(); ++PlotIdx)
+	{
+		if (const ImPlotPlot* Plot = GP.Plots.TryGetMapData(PlotIdx))
+		{
+			Stats.PlotItems += ImGui_GetBytes(Plot->Items) + ImGui_GetBytes(Plot->TextBuffer);
+
+			for (const ImPlotAxis& Axis : Plot->Axes)
+			{
+				Stats.PlotItems += ImGui_GetBytes(Axis.Ticker) + ImGui_GetBytes(Axis.TickerCache);
+			}
+		}
+	}
+
+	for (int32 SubplotIdx = 0; SubplotIdx < GP.Subplots.GetMapSize(); ++SubplotIdx)
+	{
+		if (const ImPlotSubplot* Subplot = GP.Subplots.TryGetMapData(SubplotIdx))
+		{
+			Stats.PlotItems += ImGui_GetBytes(Subplot->Items) + ImGui_GetBytes(Subplot->RowAlignmentData) + ImGui_GetBytes(Subplot->ColAlignmentData);
+			Stats.PlotItems += ImGui_GetBytes(Subplot->RowRatios) + ImGui_GetBytes(Subplot->ColRatios) + ImGui_GetBytes(Subplot->RowLinkData) + ImGui_GetBytes(Subplot->ColLinkData);
+		}
+	}
+
+	for (int32 CacheIdx = 0; CacheIdx < GP.HistogramCache.GetMapSize(); ++CacheIdx)
+	{
+		if (const ImPlotHistogramCache* Cache = GP.HistogramCache.TryGetMapData(CacheIdx))
+		{
+			Stats.PlotItems += ImGui_GetBytes(Cache->Counts);
+		}
+	}
+
+	for (const ImDrawList* Shard : GP.RenderShards)
+	{
+		Stats.PlotItems += ImGui_GetBytes(*Shard);
+	}
+
+	for (const ImVector<ImPlotPoint>* Points : GP.RenderPoints)
+	{
+		Stats.PlotItems += ImGui_GetBytes(*Points);
 	}
+
+	Stats.PlotItems += ImGui_GetBytes(GP.Plots) + ImGui_GetBytes(GP.Subplots) + ImGui_GetBytes(GP.HistogramCache) + ImGui_GetBytes(GP.AlignmentData);
+	Stats.PlotItems += ImGui_GetBytes(GP.Annotations.Annotations) + ImGui_GetBytes(GP.Annotations.TextBuffer) + ImGui_GetBytes(GP.Tags.Tags) + ImGui_GetBytes(GP.Tags.TextBuffer);
+	Stats.PlotItems += ImGui_GetBytes(GP.TempDouble1) + ImGui_GetBytes(GP.TempDouble2) + ImGui_GetBytes(GP.TempInt1) + ImGui_GetBytes(GP.TempPoints);
+	Stats.PlotItems += ImGui_GetBytes(GP.MergeVtx) + ImGui_GetBytes(GP.MergeIdx) + ImGui_GetBytes(GP.MergeCmd) + ImGui_GetBytes(GP.MergeCopies);
+
+	Stats.Total = Stats.DrawLists + Stats.Tables + Stats.Storage + Stats.TextBuffers + Stats.PlotItems;
+
+	return Stats;
 }
 
-TSharedRef<FImGuiContext> FImGuiContext::Create()
+TSharedRef<FImGuiContext> FImGuiContext::Create(const TSharedPtr<FImGuiContext>& FontAtlasContext)
 {
 	TSharedRef<FImGuiContext> Context = MakeShared<FImGuiContext>();
+	Context->FontAtlas = FontAtlasContext.IsValid() ? FontAtlasContext->FontAtlas : FImGuiFontAtlas::GetShared();
 	Context->Initialize();
 
 	return Context;
@@ -288,16 +453,17 @@ TSharedPtr<FImGuiContext> FImGuiContext::Get(const ImGuiContext* Context)
 
 void FImGuiContext::Initialize()
 {
-	ImGui::SetAllocatorFunctions(ImGui_MemAlloc, ImGui_MemFree);
-
 	IMGUI_CHECKVERSION();
 
-	Context = ImGui::CreateContext();
+	// Fonts are built in the background from module startup, wait for them so that fonts can be added right away
+	FontAtlas->WaitForBuild();
+	Context = ImGui::CreateContext(FontAtlas->Get());
 	PlotContext = ImPlot::CreateContext();
 
 	ImGui::FScopedContext ScopedContext(AsShared());
 
-	NetImgui::Startup();
+	// Large histograms are binned on the task graph
+	ImPlot::SetParallelFor(ImGui_PlotParallelFor);
 
 	ImGuiIO& IO = ImGui::GetIO();
 	IO.UserData = this;
@@ -340,9 +506,6 @@ void FImGuiContext::Initialize()
 	PlatformIO.Platform_SetWindowAlpha = ImGui_SetWindowAlpha;
 	PlatformIO.Platform_RenderWindow = ImGui_RenderWindow;
 
-	const FString FontPath = FPaths::EngineContentDir() / TEXT("Slate/Fonts/Roboto-Regular.ttf");
-	IO.Fonts->AddFontFromFileTTF(TCHAR_TO_ANSI(*FontPath), 16);
-
 	if (FSlateApplication::IsInitialized())
 	{
 		// Enable multi-viewports support for Slate applications
@@ -377,7 +540,16 @@ FImGuiContext::~FImGuiContext()
 		}
 	}
 
-	NetImgui::Shutdown();
+	if (bNetImguiStarted)
+	{
+		NetImgui::Shutdown();
+	}
+
+	DEC_MEMORY_STAT_BY(STAT_ImGui_MemoryDrawLists, MemoryStats.DrawLists);
+	DEC_MEMORY_STAT_BY(STAT_ImGui_MemoryTables, MemoryStats.Tables);
+	DEC_MEMORY_STAT_BY(STAT_ImGui_MemoryStorage, MemoryStats.Storage);
+	DEC_MEMORY_STAT_BY(STAT_ImGui_MemoryTextBuffers, MemoryStats.TextBuffers);
+	DEC_MEMORY_STAT_BY(STAT_ImGui_MemoryPlotItems, MemoryStats.PlotItems);
 
 	if (PlotContext)
 	{
@@ -403,6 +575,12 @@ bool FImGuiContext::Listen(int16 Port)
 		ClientName.Appendf(" (%d)", GPlayInEditorID);
 	}
 
+	if (!bNetImguiStarted)
+	{
+		NetImgui::Startup();
+		bNetImguiStarted = true;
+	}
+
 	// #TODO(Ves): [24/12/23] Returns false but is actually successful?
 	NetImgui::ConnectFromApp(ClientName.ToString(), Port);
 	bIsRemote = true;
@@ -421,6 +599,12 @@ bool FImGuiContext::Connect(const FString& Host, int16 Port)
 		ClientName.Appendf(" (%d)", GPlayInEditorID);
 	}
 
+	if (!bNetImguiStarted)
+	{
+		NetImgui::Startup();
+		bNetImguiStarted = true;
+	}
+
 	// #TODO(Ves): [24/12/23] Returns false but is actually successful?
 	NetImgui::ConnectToApp(ClientName.ToString(), TCHAR_TO_ANSI(*Host), Port);
 	bIsRemote = true;
@@ -437,6 +621,32 @@ void FImGuiContext::Disconnect()
 	}
 }
 
+void FImGuiContext::SetMemoryBudget(int64 Bytes)
+{
+	MemoryBudget = FMath::Max<int64>(Bytes, 0);
+	MemoryCompactedTotal = 0;
+}
+
+int64 FImGuiContext::GetMemoryBudget() const
+{
+	return MemoryBudget;
+}
+
+const FImGuiMemoryStats& FImGuiContext::GetMemoryStats() const
+{
+	return MemoryStats;
+}
+
+const FImGuiMemoryStats& FImGuiContext::GetPeakMemoryStats() const
+{
+	return PeakMemoryStats;
+}
+
+int32 FImGuiContext::GetMemoryCompactionCount() const
+{
+	return MemoryCompactionCount;
+}
+
 FImGuiContext::operator ImGuiContext*() const
 {
 	return Context;
@@ -481,41 +691,95 @@ void FImGuiContext::BeginFrame()
 		return;
 	}
 
+	IMGUI_SCOPE_CYCLE_COUNTER(BeginFrame);
+
 	ImGui::FScopedContext ScopedContext(AsShared());
 
+	// Read by the platform callbacks during the frame, and by NewFrame many times per viewport
+	for (ImGuiViewport* Viewport : ImGui::GetPlatformIO().Viewports)
+	{
+		if (FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(Viewport))
+		{
+			ViewportData->Refresh();
+		}
+	}
+
 	ImGuiIO& IO = ImGui::GetIO();
 
 	IO.DeltaTime = FApp::GetDeltaTime();
 	IO.DisplaySize = ImGui_GetWindowSize(ImGui::GetMainViewport());
 
-	if (!IO.Fonts->IsBuilt() || !FontAtlasTexturePtr.IsValid())
+	UpdateFontAtlas();
+	UpdateMemory();
+
+	ImGui::NewFrame();
+}
+
+void FImGuiContext::UpdateFontAtlas()
+{
+	FontAtlas->Update();
+
+	if (FontAtlasGeneration != FontAtlas->GetGeneration())
+	{
+		FontAtlas->ApplyMarkerSprites(PlotContext);
+		FontAtlasGeneration = FontAtlas->GetGeneration();
+	}
+}
+
+void FImGuiContext::UpdateMemory()
+{
+	// Walking the context is only worth it to enforce a budget or report the stats
+	if (MemoryBudget <= 0 && !ImGuiStats::IsCollecting())
 	{
-		uint8* TextureDataRaw;
-		int32 TextureWidth, TextureHeight, BytesPerPixel;
-		IO.Fonts->GetTexDataAsRGBA32(&TextureDataRaw, &TextureWidth, &TextureHeight, &BytesPerPixel);
+		return;
+	}
 
-#if WITH_ENGINE
-		UTexture2D* FontAtlasTexture = UTexture2D::CreateTransient(TextureWidth, TextureHeight, PF_R8G8B8A8, TEXT("ImGuiFontAtlas"));
-		FontAtlasTexture->Filter = TF_Bilinear;
-		FontAtlasTexture->AddressX = TA_Wrap;
-		FontAtlasTexture->AddressY = TA_Wrap;
-
-		uint8* FontAtlasTextureData = static_cast<uint8*>(FontAtlasTexture->GetPlatformData()->Mips[0].BulkData.Lock(LOCK_READ_WRITE));
-		FMemory::Memcpy(FontAtlasTextureData, TextureDataRaw, TextureWidth * TextureHeight * BytesPerPixel);
-		FontAtlasTexture->GetPlatformData()->Mips[0].BulkData.Unlock();
-		FontAtlasTexture->UpdateResource();
-
-		FontAtlasTexturePtr.Reset(FontAtlasTexture);
-#else
-		FontAtlasTexturePtr = FSlateDynamicImageBrush::CreateWithImageData(
-			TEXT("ImGuiFontAtlas"), FVector2D(TextureWidth, TextureHeight),
-			TArray(TextureDataRaw, TextureWidth * TextureHeight * BytesPerPixel));
-#endif
+	IMGUI_SCOPE_CYCLE_COUNTER(UpdateMemory);
+
+	const FImGuiMemoryStats PrevMemoryStats = MemoryStats;
+	MemoryStats = ImGui_GetMemoryStats(*Context, *PlotContext);
+
+	IMGUI_UPDATE_MEMORY(MemoryDrawLists, PrevMemoryStats.DrawLists, MemoryStats.DrawLists);
+	IMGUI_UPDATE_MEMORY(MemoryTables, PrevMemoryStats.Tables, MemoryStats.Tables);
+	IMGUI_UPDATE_MEMORY(MemoryStorage, PrevMemoryStats.Storage, MemoryStats.Storage);
+	IMGUI_UPDATE_MEMORY(MemoryTextBuffers, PrevMemoryStats.TextBuffers, MemoryStats.TextBuffers);
+	IMGUI_UPDATE_MEMORY(MemoryPlotItems, PrevMemoryStats.PlotItems, MemoryStats.PlotItems);
+
+	PeakMemoryStats.DrawLists = FMath::Max(PeakMemoryStats.DrawLists, MemoryStats.DrawLists);
+	PeakMemoryStats.Tables = FMath::Max(PeakMemoryStats.Tables, MemoryStats.Tables);
+	PeakMemoryStats.Storage = FMath::Max(PeakMemoryStats.Storage, MemoryStats.Storage);
+	PeakMemoryStats.TextBuffers = FMath::Max(PeakMemoryStats.TextBuffers, MemoryStats.TextBuffers);
+	PeakMemoryStats.PlotItems = FMath::Max(PeakMemoryStats.PlotItems, MemoryStats.PlotItems);
+	PeakMemoryStats.Total = FMath::Max(PeakMemoryStats.Total, MemoryStats.Total);
 
-		IO.Fonts->SetTexID(FontAtlasTexturePtr.Get());
+	if (bMemoryCompacted)
+	{
+		// Includes the buffers of the windows and tables shown since, which grew back during the last frame
+		MemoryCompactedTotal = MemoryStats.Total;
+		bMemoryCompacted = false;
 	}
+	else if (MemoryBudget > 0 && MemoryStats.Total > MemoryBudget && MemoryStats.Total > MemoryCompactedTotal)
+	{
+		IMGUI_INC_COUNTER(MemoryCompactions, 1);
+		++MemoryCompactionCount;
+		bMemoryCompacted = true;
 
-	ImGui::NewFrame();
+		// NewFrame compacts the windows which weren't shown in the last frame, and all tables
+		Context->GcCompactAll = true;
+
+		ImPlot::GcCompactTransientBuffers(PlotContext, Context->FrameCount);
+
+		// The state of the active input text is kept
+		if (Context->InputTextState.ID != Context->ActiveId)
+		{
+			Context->InputTextState.ClearFreeMemory();
+			Context->InputTextState.ID = 0;
+		}
+	}
+	else if (MemoryStats.Total <= MemoryBudget)
+	{
+		MemoryCompactedTotal = 0;
+	}
 }
 
 void FImGuiContext::EndFrame()
@@ -525,13 +789,55 @@ void FImGuiContext::EndFrame()
 		return;
 	}
 
+	IMGUI_SCOPE_CYCLE_COUNTER(EndFrame);
+
 	ImGui::FScopedContext ScopedContext(AsShared());
 
-	ImGui::Render();
-	ImGui::UpdatePlatformWindows();
+	if (OnDraw.IsBound())
+	{
+		ImGuiStats::BeginWidgets();
+		OnDraw.Broadcast();
+		ImGuiStats::EndWidgets();
+	}
+
+	{
+		IMGUI_SCOPE_CYCLE_COUNTER(ReplayDeferred);
+		FImGuiDeferredScope::Replay(*this);
+	}
+
+	{
+		IMGUI_SCOPE_CYCLE_COUNTER(Render);
+		ImGui::Render();
+	}
+
+	{
+		IMGUI_SCOPE_CYCLE_COUNTER(UpdatePlatformWindows);
+		ImGui::UpdatePlatformWindows();
+	}
+
+#if STATS || COUNTERSTRACE_ENABLED
+	for (const ImGuiViewport* Viewport : ImGui::GetPlatformIO().Viewports)
+	{
+		const ImDrawData* DrawData = Viewport->DrawData;
+		if (DrawData && DrawData->Valid)
+		{
+			int32 CmdCount = 0;
+			for (const ImDrawList* DrawList : DrawData->CmdLists)
+			{
+				CmdCount += DrawList->CmdBuffer.Size;
+			}
+
+			IMGUI_INC_COUNTER(Vertices, DrawData->TotalVtxCount);
+			IMGUI_INC_COUNTER(Indices, DrawData->TotalIdxCount);
+			IMGUI_INC_COUNTER(DrawCommands, CmdCount);
+			IMGUI_INC_COUNTER(DrawLists, DrawData->CmdListsCount);
+		}
+	}
+#endif
 
 	if (!bIsRemote)
 	{
+		IMGUI_SCOPE_CYCLE_COUNTER(RenderPlatformWindows);
 		ImGui_RenderWindow(ImGui::GetMainViewport(), nullptr);
 		ImGui::RenderPlatformWindowsDefault();
 	}
@@ -0,0 +1,559 @@
+#include "ImGuiDeferred.h"
+
+#include <Algo/Reverse.h>
+#include <CoreGlobals.h>
+#include <HAL/UnrealMemory.h>
+
+THIRD_PARTY_INCLUDES_START
+#include <imgui_internal.h>
+#include <implot.h>
+THIRD_PARTY_INCLUDES_END
+
+#include <atomic>
+#include <cstdarg>
+
+#include "ImGuiContext.h"
+
+/// Capacity of the recycled chunks, larger commands get a chunk of their own
+static constexpr int32 GImGui_DeferredChunkCapacity = 64 * 1024;
+
+/// Batches not replayed within this many frames of being published are dropped
+static constexpr uint64 GImGui_DeferredMaxAge = 16;
+
+/// Longest text recorded, including the terminator
+static constexpr int32 GImGui_DeferredMaxTextSize = 1024;
+
+enum class EImGuiDeferredCommand : uint8
+{
+	BeginWindow,
+	EndWindow,
+	Text,
+	Separator,
+	PlotLine,
+	AddLine,
+	AddRect,
+	AddRectFilled,
+	AddCircle,
+	AddCircleFilled,
+	AddText
+};
+
+/// Header of a recorded command followed by its payload
+struct alignas(8) FImGuiDeferredCommand
+{
+	EImGuiDeferredCommand Type;
+
+	/// Bytes to the next command
+	uint32 Size;
+
+	uint8* GetPayload() { return reinterpret_cast<uint8*>(this + 1); }
+};
+
+/// Payload of the draw list primitives, circles store their radius in B.x
+struct FImGuiDeferredPrimitive
+{
+	ImVec2 A;
+	ImVec2 B;
+	uint32 Color;
+	float Thickness;
+};
+
+struct alignas(16) FImGuiDeferredChunk
+{
+	/// Next chunk of the same batch or free list
+	FImGuiDeferredChunk* Next = nullptr;
+
+	/// Next published batch, only used by the first chunk of a batch like the fields below
+	FImGuiDeferredChunk* NextBatch = nullptr;
+	TWeakPtr<FImGuiContext> Context;
+	uint64 Frame = 0;
+
+	int32 Capacity = 0;
+	int32 Size = 0;
+
+	uint8* GetData() { return reinterpret_cast<uint8*>(this + 1); }
+};
+
+/// Published batches in reverse order, linked through NextBatch
+static std::atomic<FImGuiDeferredChunk*> GImGui_DeferredBatches = nullptr;
+
+/// Recycled chunks, linked through Next
+static std::atomic<FImGuiDeferredChunk*> GImGui_DeferredFreeChunks = nullptr;
+
+/// Published batches in order, moved out of GImGui_DeferredBatches on the game thread
+static TArray<FImGuiDeferredChunk*> GImGui_DeferredPending;
+
+static void ImGui_PushDeferredFreeChunk(FImGuiDeferredChunk* Chunk)
+{
+	Chunk->Next = GImGui_DeferredFreeChunks.load(std::memory_order_relaxed);
+	while (!GImGui_DeferredFreeChunks.compare_exchange_weak(Chunk->Next, Chunk, std::memory_order_release, std::memory_order_relaxed))
+	{
+	}
+}
+
+static void ImGui_ReleaseDeferredBatch(FImGuiDeferredChunk* Batch)
+{
+	Batch->Context.Reset();
+	while (Batch)
+	{
+		FImGuiDeferredChunk* Next = Batch->Next;
+		if (Batch->Capacity == GImGui_DeferredChunkCapacity)
+		{
+			ImGui_PushDeferredFreeChunk(Batch);
+		}
+		else
+		{
+			Batch->~FImGuiDeferredChunk();
+			FMemory::Free(Batch);
+		}
+		Batch = Next;
+	}
+}
+
+/// Commands of the current thread, only touched by that thread until a batch is published
+struct FImGuiDeferredRecorder
+{
+	~FImGuiDeferredRecorder()
+	{
+		while (FreeChunks)
+		{
+			FImGuiDeferredChunk* Next = FreeChunks->Next;
+			ImGui_PushDeferredFreeChunk(FreeChunks);
+			FreeChunks = Next;
+		}
+	}
+
+	/// Reserves a command with room for a payload of up to MaxPayloadSize bytes, completed by EndCommand
+	FImGuiDeferredCommand* BeginCommand(EImGuiDeferredCommand Type, int32 MaxPayloadSize)
+	{
+		const int32 MaxSize = Align(static_cast<int32>(sizeof(FImGuiDeferredCommand)) + MaxPayloadSize, alignof(FImGuiDeferredCommand));
+		if (!Current || Current->Size + MaxSize > Current->Capacity)
+		{
+			AddChunk(MaxSize);
+		}
+
+		FImGuiDeferredCommand* Command = reinterpret_cast<FImGuiDeferredCommand*>(Current->GetData() + Current->Size);
+		Command->Type = Type;
+		return Command;
+	}
+
+	void EndCommand(FImGuiDeferredCommand* Command, int32 PayloadSize)
+	{
+		Command->Size = Align(static_cast<uint32>(sizeof(FImGuiDeferredCommand)) + PayloadSize, alignof(FImGuiDeferredCommand));
+		Current->Size += Command->Size;
+	}
+
+	void AddChunk(int32 MinCapacity)
+	{
+		FImGuiDeferredChunk* Chunk = nullptr;
+		if (MinCapacity <= GImGui_DeferredChunkCapacity)
+		{
+			if (!FreeChunks)
+			{
+				FreeChunks = GImGui_DeferredFreeChunks.exchange(nullptr, std::memory_order_acquire);
+			}
+
+			if (FreeChunks)
+			{
+				Chunk = FreeChunks;
+				FreeChunks = Chunk->Next;
+				Chunk->Next = nullptr;
+				Chunk->Size = 0;
+			}
+		}
+
+		if (!Chunk)
+		{
+			const int32 Capacity = FMath::Max(MinCapacity, GImGui_DeferredChunkCapacity);
+			Chunk = new(FMemory::Malloc(sizeof(FImGuiDeferredChunk) + Capacity, alignof(FImGuiDeferredChunk))) FImGuiDeferredChunk();
+			Chunk->Capacity = Capacity;
+		}
+
+		if (Current)
+		{
+			Current->Next = Chunk;
+		}
+		else
+		{
+			First = Chunk;
+		}
+		Current = Chunk;
+	}
+
+	void Publish()
+	{
+		if (First)
+		{
+			First->Context = MoveTemp(Context);
+			First->Frame = GFrameCounter;
+			First->NextBatch = GImGui_DeferredBatches.load(std::memory_order_relaxed);
+			while (!GImGui_DeferredBatches.compare_exchange_weak(First->NextBatch, First, std::memory_order_release, std::memory_order_relaxed))
+			{
+			}
+		}
+
+		First = nullptr;
+		Current = nullptr;
+		Context.Reset();
+	}
+
+	FImGuiDeferredChunk* FreeChunks = nullptr;
+
+	/// Batch being recorded
+	FImGuiDeferredChunk* First = nullptr;
+	FImGuiDeferredChunk* Current = nullptr;
+	TWeakPtr<FImGuiContext> Context;
+	int32 Depth = 0;
+};
+
+static thread_local FImGuiDeferredRecorder GImGui_DeferredRecorder;
+
+static void ImGui_RecordString(FImGuiDeferredRecorder& Recorder, EImGuiDeferredCommand Type, const char* String)
+{
+	const int32 StringSize = FCStringAnsi::Strlen(String) + 1;
+	FImGuiDeferredCommand* Command = Recorder.BeginCommand(Type, StringSize);
+	FMemory::Memcpy(Command->GetPayload(), String, StringSize);
+	Recorder.EndCommand(Command, StringSize);
+}
+
+static void ImGui_RecordText(FImGuiDeferredRecorder& Recorder, uint32 Color, const char* Fmt, va_list Args)
+{
+	FImGuiDeferredCommand* Command = Recorder.BeginCommand(EImGuiDeferredCommand::Text, sizeof(uint32) + GImGui_DeferredMaxTextSize);
+	uint8* Payload = Command->GetPayload();
+	FMemory::Memcpy(Payload, &Color, sizeof(uint32));
+	const int32 TextLength = ImFormatStringV(reinterpret_cast<char*>(Payload + sizeof(uint32)), GImGui_DeferredMaxTextSize, Fmt, Args);
+	Recorder.EndCommand(Command, sizeof(uint32) + TextLength + 1);
+}
+
+static void ImGui_RecordPrimitive(FImGuiDeferredRecorder& Recorder, EImGuiDeferredCommand Type, const FImGuiDeferredPrimitive& Primitive)
+{
+	FImGuiDeferredCommand* Command = Recorder.BeginCommand(Type, sizeof(FImGuiDeferredPrimitive));
+	FMemory::Memcpy(Command->GetPayload(), &Primitive, sizeof(FImGuiDeferredPrimitive));
+	Recorder.EndCommand(Command, sizeof(FImGuiDeferredPrimitive));
+}
+
+FImGuiDeferredScope::FImGuiDeferredScope(const TSharedPtr<FImGuiContext>& Context, const char* WindowName)
+	: Recorder(GImGui_DeferredRecorder)
+{
+	if (Recorder.Depth++ == 0)
+	{
+		Recorder.Context = Context;
+	}
+	else
+	{
+		ensureMsgf(Recorder.Context.HasSameObject(Context.Get()), TEXT("Nested deferred scopes must record for the same context"));
+	}
+
+	if (WindowName)
+	{
+		ImGui_RecordString(Recorder, EImGuiDeferredCommand::BeginWindow, WindowName);
+		bWindow = true;
+	}
+}
+
+FImGuiDeferredScope::~FImGuiDeferredScope()
+{
+	if (bWindow)
+	{
+		FImGuiDeferredCommand* Command = Recorder.BeginCommand(EImGuiDeferredCommand::EndWindow, 0);
+		Recorder.EndCommand(Command, 0);
+	}
+
+	if (--Recorder.Depth == 0)
+	{
+		Recorder.Publish();
+	}
+}
+
+void FImGuiDeferredScope::Text(const char* Fmt, ...)
+{
+	va_list Args;
+	va_start(Args, Fmt);
+	ImGui_RecordText(Recorder, 0, Fmt, Args);
+	va_end(Args);
+}
+
+void FImGuiDeferredScope::TextColored(uint32 Color, const char* Fmt, ...)
+{
+	va_list Args;
+	va_start(Args, Fmt);
+	ImGui_RecordText(Recorder, Color, Fmt, Args);
+	va_end(Args);
+}
+
+void FImGuiDeferredScope::Separator()
+{
+	FImGuiDeferredCommand* Command = Recorder.BeginCommand(EImGuiDeferredCommand::Separator, 0);
+	Recorder.EndCommand(Command, 0);
+}
+
+void FImGuiDeferredScope::PlotLine(const char* PlotName, const char* SeriesName, const float* Values, int32 Count)
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	// Count, plot name size, values, plot name, series name
+	const int32 PlotNameSize = FCStringAnsi::Strlen(PlotName) + 1;
+	const int32 SeriesNameSize = FCStringAnsi::Strlen(SeriesName) + 1;
+	const int32 ValuesSize = Count * sizeof(float);
+	const int32 PayloadSize = 2 * sizeof(int32) + ValuesSize + PlotNameSize + SeriesNameSize;
+
+	FImGuiDeferredCommand* Command = Recorder.BeginCommand(EImGuiDeferredCommand::PlotLine, PayloadSize);
+	uint8* Payload = Command->GetPayload();
+	FMemory::Memcpy(Payload, &Count, sizeof(int32));
+	FMemory::Memcpy(Payload + sizeof(int32), &PlotNameSize, sizeof(int32));
+	FMemory::Memcpy(Payload + 2 * sizeof(int32), Values, ValuesSize);
+	FMemory::Memcpy(Payload + 2 * sizeof(int32) + ValuesSize, PlotName, PlotNameSize);
+	FMemory::Memcpy(Payload + 2 * sizeof(int32) + ValuesSize + PlotNameSize, SeriesName, SeriesNameSize);
+	Recorder.EndCommand(Command, PayloadSize);
+}
+
+void FImGuiDeferredScope::AddLine(const ImVec2& P1, const ImVec2& P2, uint32 Color, float Thickness)
+{
+	ImGui_RecordPrimitive(Recorder, EImGuiDeferredCommand::AddLine, { P1, P2, Color, Thickness });
+}
+
+void FImGuiDeferredScope::AddRect(const ImVec2& Min, const ImVec2& Max, uint32 Color, float Thickness)
+{
+	ImGui_RecordPrimitive(Recorder, EImGuiDeferredCommand::AddRect, { Min, Max, Color, Thickness });
+}
+
+void FImGuiDeferredScope::AddRectFilled(const ImVec2& Min, const ImVec2& Max, uint32 Color)
+{
+	ImGui_RecordPrimitive(Recorder, EImGuiDeferredCommand::AddRectFilled, { Min, Max, Color, 0.0f });
+}
+
+void FImGuiDeferredScope::AddCircle(const ImVec2& Center, float Radius, uint32 Color, float Thickness)
+{
+	ImGui_RecordPrimitive(Recorder, EImGuiDeferredCommand::AddCircle, { Center, ImVec2(Radius, 0.0f), Color, Thickness });
+}
+
+void FImGuiDeferredScope::AddCircleFilled(const ImVec2& Center, float Radius, uint32 Color)
+{
+	ImGui_RecordPrimitive(Recorder, EImGuiDeferredCommand::AddCircleFilled, { Center, ImVec2(Radius, 0.0f), Color, 0.0f });
+}
+
+void FImGuiDeferredScope::AddText(const ImVec2& Pos, uint32 Color, const char* Text)
+{
+	const int32 TextSize = FCStringAnsi::Strlen(Text) + 1;
+	FImGuiDeferredCommand* Command = Recorder.BeginCommand(EImGuiDeferredCommand::AddText, sizeof(ImVec2) + sizeof(uint32) + TextSize);
+	uint8* Payload = Command->GetPayload();
+	FMemory::Memcpy(Payload, &Pos, sizeof(ImVec2));
+	FMemory::Memcpy(Payload + sizeof(ImVec2), &Color, sizeof(uint32));
+	FMemory::Memcpy(Payload + sizeof(ImVec2) + sizeof(uint32), Text, TextSize);
+	Recorder.EndCommand(Command, sizeof(ImVec2) + sizeof(uint32) + TextSize);
+}
+
+static void ImGui_ReplayDeferredBatch(FImGuiDeferredChunk* Batch)
+{
+	// Visibility of the windows begun by the batch, content of collapsed windows is skipped
+	TArray<bool, TInlineAllocator<8>> WindowsVisible;
+
+	// Consecutive series of the same plot share a BeginPlot
+	const char* OpenPlot = nullptr;
+	bool bPlotVisible = false;
+
+	const auto ClosePlot = [&OpenPlot, &bPlotVisible]()
+	{
+		if (OpenPlot && bPlotVisible)
+		{
+			ImPlot::EndPlot();
+		}
+		OpenPlot = nullptr;
+	};
+
+	for (FImGuiDeferredChunk* Chunk = Batch; Chunk; Chunk = Chunk->Next)
+	{
+		for (int32 Offset = 0; Offset < Chunk->Size;)
+		{
+			FImGuiDeferredCommand* Command = reinterpret_cast<FImGuiDeferredCommand*>(Chunk->GetData() + Offset);
+			const uint8* Payload = Command->GetPayload();
+			Offset += Command->Size;
+
+			if (Command->Type != EImGuiDeferredCommand::PlotLine)
+			{
+				ClosePlot();
+			}
+
+			if (Command->Type == EImGuiDeferredCommand::BeginWindow)
+			{
+				WindowsVisible.Push(ImGui::Begin(reinterpret_cast<const char*>(Payload)));
+				continue;
+			}
+
+			if (Command->Type == EImGuiDeferredCommand::EndWindow)
+			{
+				ImGui::End();
+				WindowsVisible.Pop();
+				continue;
+			}
+
+			if (WindowsVisible.Num() > 0 && !WindowsVisible.Last())
+			{
+				continue;
+			}
+
+			switch (Command->Type)
+			{
+			case EImGuiDeferredCommand::Text:
+				{
+					uint32 Color;
+					FMemory::Memcpy(&Color, Payload, sizeof(uint32));
+					if (Color != 0)
+					{
+						ImGui::PushStyleColor(ImGuiCol_Text, Color);
+					}
+					ImGui::TextUnformatted(reinterpret_cast<const char*>(Payload + sizeof(uint32)));
+					if (Color != 0)
+					{
+						ImGui::PopStyleColor();
+					}
+					break;
+				}
+			case EImGuiDeferredCommand::Separator:
+				{
+					ImGui::Separator();
+					break;
+				}
+			case EImGuiDeferredCommand::PlotLine:
+				{
+					int32 Count, PlotNameSize;
+					FMemory::Memcpy(&Count, Payload, sizeof(int32));
+					FMemory::Memcpy(&PlotNameSize, Payload + sizeof(int32), sizeof(int32));
+					const float* Values = reinterpret_cast<const float*>(Payload + 2 * sizeof(int32));
+					const char* PlotName = reinterpret_cast<const char*>(Values + Count);
+					const char* SeriesName = PlotName + PlotNameSize;
+
+					if (!OpenPlot || FCStringAnsi::Strcmp(OpenPlot, PlotName) != 0)
+					{
+						ClosePlot();
+						OpenPlot = PlotName;
+						bPlotVisible = ImPlot::BeginPlot(PlotName);
+					}
+
+					if (bPlotVisible)
+					{
+						ImPlot::PlotLine(SeriesName, Values, Count);
+					}
+					break;
+				}
+			case EImGuiDeferredCommand::AddText:
+				{
+					ImVec2 Pos;
+					uint32 Color;
+					FMemory::Memcpy(&Pos, Payload, sizeof(ImVec2));
+					FMemory::Memcpy(&Color, Payload + sizeof(ImVec2), sizeof(uint32));
+
+					ImDrawList* DrawList = WindowsVisible.Num() > 0 ? ImGui::GetWindowDrawList() : ImGui::GetForegroundDrawList();
+					const ImVec2 Origin = WindowsVisible.Num() > 0 ? ImGui::GetCursorScreenPos() : ImVec2(0.0f, 0.0f);
+					DrawList->AddText(ImVec2(Origin.x + Pos.x, Origin.y + Pos.y), Color, reinterpret_cast<const char*>(Payload + sizeof(ImVec2) + sizeof(uint32)));
+					break;
+				}
+			default:
+				{
+					FImGuiDeferredPrimitive Primitive;
+					FMemory::Memcpy(&Primitive, Payload, sizeof(FImGuiDeferredPrimitive));
+
+					ImDrawList* DrawList = WindowsVisible.Num() > 0 ? ImGui::GetWindowDrawList() : ImGui::GetForegroundDrawList();
+					const ImVec2 Origin = WindowsVisible.Num() > 0 ? ImGui::GetCursorScreenPos() : ImVec2(0.0f, 0.0f);
+					const ImVec2 A(Origin.x + Primitive.A.x, Origin.y + Primitive.A.y);
+					const ImVec2 B(Origin.x + Primitive.B.x, Origin.y + Primitive.B.y);
+
+					if (Command->Type == EImGuiDeferredCommand::AddLine)
+					{
+						DrawList->AddLine(A, B, Primitive.Color, Primitive.Thickness);
+					}
+					else if (Command->Type == EImGuiDeferredCommand::AddRect)
+					{
+						DrawList->AddRect(A, B, Primitive.Color, 0.0f, ImDrawFlags_None, Primitive.Thickness);
+					}
+					else if (Command->Type == EImGuiDeferredCommand::AddRectFilled)
+					{
+						DrawList->AddRectFilled(A, B, Primitive.Color);
+					}
+					else if (Command->Type == EImGuiDeferredCommand::AddCircle)
+					{
+						DrawList->AddCircle(A, Primitive.B.x, Primitive.Color, 0, Primitive.Thickness);
+					}
+					else if (Command->Type == EImGuiDeferredCommand::AddCircleFilled)
+					{
+						DrawList->AddCircleFilled(A, Primitive.B.x, Primitive.Color);
+					}
+					break;
+				}
+			}
+		}
+	}
+
+	ClosePlot();
+}
+
+/// Moves the batches published since the last call to the end of the pending ones
+static void ImGui_DrainDeferredBatches()
+{
+	// Published batches are linked newest first
+	const int32 FirstNewIdx = GImGui_DeferredPending.Num();
+	for (FImGuiDeferredChunk* Batch = GImGui_DeferredBatches.exchange(nullptr, std::memory_order_acquire); Batch; Batch = Batch->NextBatch)
+	{
+		GImGui_DeferredPending.Add(Batch);
+	}
+	Algo::Reverse(GImGui_DeferredPending.GetData() + FirstNewIdx, GImGui_DeferredPending.Num() - FirstNewIdx);
+}
+
+void FImGuiDeferredScope::Replay(const FImGuiContext& Context)
+{
+	check(IsInGameThread());
+
+	ImGui_DrainDeferredBatches();
+
+	int32 KeptCount = 0;
+	for (FImGuiDeferredChunk* Batch : GImGui_DeferredPending)
+	{
+		const TSharedPtr<FImGuiContext> BatchContext = Batch->Context.Pin();
+		if (BatchContext.Get() == &Context)
+		{
+			ImGui_ReplayDeferredBatch(Batch);
+			ImGui_ReleaseDeferredBatch(Batch);
+		}
+		else if (!BatchContext.IsValid())
+		{
+			ImGui_ReleaseDeferredBatch(Batch);
+		}
+		else
+		{
+			GImGui_DeferredPending[KeptCount++] = Batch;
+		}
+	}
+	GImGui_DeferredPending.SetNum(KeptCount);
+}
+
+void FImGuiDeferredScope::Trim(uint64 Frame)
+{
+	check(IsInGameThread());
+
+	ImGui_DrainDeferredBatches();
+
+	int32 KeptCount = 0;
+	for (FImGuiDeferredChunk* Batch : GImGui_DeferredPending)
+	{
+		if (!Batch->Context.IsValid() || Frame > Batch->Frame + GImGui_DeferredMaxAge)
+		{
+			ImGui_ReleaseDeferredBatch(Batch);
+		}
+		else
+		{
+			GImGui_DeferredPending[KeptCount++] = Batch;
+		}
+	}
+	GImGui_DeferredPending.SetNum(KeptCount);
+}
+
+int32 FImGuiDeferredScope::GetPendingBatchCount()
+{
+	check(IsInGameThread());
+
+	ImGui_DrainDeferredBatches();
+	return GImGui_DeferredPending.Num();
+}
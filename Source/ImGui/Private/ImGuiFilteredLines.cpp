@@ -0,0 +1,255 @@
+#include "ImGuiFilteredLines.h"
+
+#include <Misc/ScopeLock.h>
+#include <Tasks/Task.h>
+
+THIRD_PARTY_INCLUDES_START
+#include <imgui.h>
+#include <imgui_internal.h>
+THIRD_PARTY_INCLUDES_END
+
+/// Returns true if every line passing Next also passes Prev, so that Next only needs to test the lines matched by Prev
+static bool ImGui_IsNarrowingFilter(const ImGuiTextFilter& Prev, const ImGuiTextFilter& Next)
+{
+	using FRange = ImGuiTextFilter::ImGuiTextRange;
+
+	// PassFilter returns on the first term found in the text, so an exclusion only applies when it comes before an inclusion
+	const auto IsInclusion = [](const FRange& Range) { return !Range.empty() && Range.b[0] != '-'; };
+	const auto IsExclusion = [](const FRange& Range) { return !Range.empty() && Range.b[0] == '-' && Range.b + 1 != Range.e; };
+
+	int32 PrevLastInclusion = -1;
+	for (int32 Idx = 0; Idx < Prev.Filters.Size; ++Idx)
+	{
+		PrevLastInclusion = IsInclusion(Prev.Filters[Idx]) ? Idx : PrevLastInclusion;
+	}
+
+	int32 NextFirstInclusion = Next.Filters.Size;
+	for (int32 Idx = Next.Filters.Size - 1; Idx >= 0; --Idx)
+	{
+		NextFirstInclusion = IsInclusion(Next.Filters[Idx]) ? Idx : NextFirstInclusion;
+	}
+
+	// Each inclusion must contain a previous inclusion, there being no previous inclusion means everything was included
+	if (Prev.CountGrep > 0)
+	{
+		if (Next.CountGrep == 0)
+		{
+			return false;
+		}
+
+		for (const FRange& NextRange : Next.Filters)
+		{
+			if (!IsInclusion(NextRange))
+			{
+				continue;
+			}
+
+			bool bContainsPrev = false;
+			for (const FRange& PrevRange : Prev.Filters)
+			{
+				bContainsPrev |= IsInclusion(PrevRange) && ImStristr(NextRange.b, NextRange.e, PrevRange.b, PrevRange.e);
+			}
+
+			if (!bContainsPrev)
+			{
+				return false;
+			}
+		}
+	}
+
+	// Each applicable previous exclusion must contain an exclusion that applies before any of the inclusions
+	for (int32 PrevIdx = 0; PrevIdx < Prev.Filters.Size; ++PrevIdx)
+	{
+		const FRange& PrevRange = Prev.Filters[PrevIdx];
+		if (!IsExclusion(PrevRange) || (Prev.CountGrep > 0 && PrevIdx > PrevLastInclusion))
+		{
+			continue;
+		}
+
+		bool bContainsNext = false;
+		for (int32 NextIdx = 0; NextIdx < NextFirstInclusion; ++NextIdx)
+		{
+			const FRange& NextRange = Next.Filters[NextIdx];
+			bContainsNext |= IsExclusion(NextRange) && ImStristr(PrevRange.b + 1, PrevRange.e, NextRange.b + 1, NextRange.e);
+		}
+
+		if (!bContainsNext)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/// Tests a list of candidate lines followed by a range of lines against a query, publishing matches in chunks
+struct FImGuiFilteredLines::FPass
+{
+	static constexpr int32 ChunkSize = 4096;
+
+	FPass(const char* Query, const FGetLine& InGetLine)
+		: Filter(Query)
+		, GetLine(InGetLine)
+	{
+	}
+
+	int32 NumItems() const
+	{
+		return CandidateLines.Num() + (RangeEnd - RangeBegin);
+	}
+
+	int32 GetItemLine(int32 ItemIndex) const
+	{
+		return ItemIndex < CandidateLines.Num() ? CandidateLines[ItemIndex] : RangeBegin + (ItemIndex - CandidateLines.Num());
+	}
+
+	void Run()
+	{
+		TArray<int32> ChunkMatches;
+		ChunkMatches.Reserve(ChunkSize);
+
+		const int32 ItemCount = NumItems();
+		for (int32 ChunkBegin = 0; ChunkBegin < ItemCount && !bCancel.load(std::memory_order_relaxed); ChunkBegin += ChunkSize)
+		{
+			const int32 ChunkEnd = FMath::Min(ChunkBegin + ChunkSize, ItemCount);
+			for (int32 ItemIndex = ChunkBegin; ItemIndex < ChunkEnd; ++ItemIndex)
+			{
+				const int32 LineIndex = GetItemLine(ItemIndex);
+				const FAnsiStringView Line = GetLine(LineIndex);
+				if (Filter.PassFilter(Line.GetData(), Line.GetData() + Line.Len()))
+				{
+					ChunkMatches.Add(LineIndex);
+				}
+			}
+
+			FScopeLock Lock(&Mutex);
+			PendingMatches.Append(ChunkMatches);
+			NumProcessedItems = ChunkEnd;
+			ChunkMatches.Reset();
+		}
+
+		bDone = true;
+	}
+
+	ImGuiTextFilter Filter;
+	FGetLine GetLine;
+
+	/// Lines to test, all before RangeBegin and in ascending order
+	TArray<int32> CandidateLines;
+	int32 RangeBegin = 0;
+	int32 RangeEnd = 0;
+
+	UE::Tasks::FTask Task;
+	std::atomic<bool> bCancel = false;
+	std::atomic<bool> bDone = false;
+
+	FCriticalSection Mutex;
+	TArray<int32> PendingMatches;
+	int32 NumProcessedItems = 0;
+};
+
+FImGuiFilteredLines::FImGuiFilteredLines(FGetLine InGetLine)
+	: GetLine(MoveTemp(InGetLine))
+{
+}
+
+FImGuiFilteredLines::~FImGuiFilteredLines()
+{
+	CancelPass();
+}
+
+void FImGuiFilteredLines::Update(const ImGuiTextFilter& Filter, int32 LineCount)
+{
+	CollectMatches();
+
+	if (!Pass.IsValid() || FCStringAnsi::Strcmp(Pass->Filter.InputBuf, Filter.InputBuf) != 0)
+	{
+		const TSharedRef<FPass> NewPass = MakeShared<FPass>(Filter.InputBuf, GetLine);
+		NewPass->RangeEnd = LineCount;
+
+		if (Pass.IsValid() && ImGui_IsNarrowingFilter(Pass->Filter, NewPass->Filter))
+		{
+			CancelPass();
+
+			// Lines processed so far only need their matches tested again, the others are carried over from the interrupted pass
+			const int32 NumProcessedItems = Pass->NumProcessedItems;
+			const int32 NumCandidates = Pass->CandidateLines.Num();
+
+			NewPass->CandidateLines = MoveTemp(Matches);
+			if (NumProcessedItems < NumCandidates)
+			{
+				NewPass->CandidateLines.Append(Pass->CandidateLines.GetData() + NumProcessedItems, NumCandidates - NumProcessedItems);
+			}
+			NewPass->RangeBegin = FMath::Min(Pass->RangeBegin + FMath::Max(NumProcessedItems - NumCandidates, 0), LineCount);
+		}
+		else
+		{
+			CancelPass();
+		}
+
+		Matches.Reset();
+		StartPass(NewPass);
+	}
+	else if (LineCount > Pass->RangeEnd && Pass->bDone)
+	{
+		// Same query, only filter the appended lines
+		CollectMatches();
+		const TSharedRef<FPass> NewPass = MakeShared<FPass>(Filter.InputBuf, GetLine);
+		NewPass->RangeBegin = Pass->RangeEnd;
+		NewPass->RangeEnd = LineCount;
+		StartPass(NewPass);
+	}
+}
+
+void FImGuiFilteredLines::Reset()
+{
+	CancelPass();
+	Pass.Reset();
+	Matches.Reset();
+}
+
+bool FImGuiFilteredLines::IsFiltering() const
+{
+	return Pass.IsValid() && !Pass->bDone;
+}
+
+void FImGuiFilteredLines::StartPass(const TSharedRef<FPass>& NewPass)
+{
+	Pass = NewPass;
+
+	if (NewPass->NumItems() < AsyncLineThreshold)
+	{
+		NewPass->Run();
+	}
+	else
+	{
+		// The pass is owned here and outlives the task, see CancelPass
+		FPass* PassPtr = &NewPass.Get();
+		NewPass->Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [PassPtr]() { PassPtr->Run(); });
+	}
+
+	CollectMatches();
+}
+
+void FImGuiFilteredLines::CancelPass()
+{
+	if (Pass.IsValid())
+	{
+		Pass->bCancel = true;
+		if (Pass->Task.IsValid())
+		{
+			Pass->Task.Wait();
+		}
+		CollectMatches();
+	}
+}
+
+void FImGuiFilteredLines::CollectMatches()
+{
+	if (Pass.IsValid())
+	{
+		FScopeLock Lock(&Pass->Mutex);
+		Matches.Append(Pass->PendingMatches);
+		Pass->PendingMatches.Reset();
+	}
+}
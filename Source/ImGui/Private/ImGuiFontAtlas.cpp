@@ -0,0 +1,197 @@
+#include "ImGuiFontAtlas.h"
+
+#include <Brushes/SlateDynamicImageBrush.h>
+#include <HAL/LowLevelMemTracker.h>
+#include <HAL/UnrealMemory.h>
+#include <Misc/Paths.h>
+
+#if WITH_ENGINE
+#include <TextureResource.h>
+#endif
+
+#include "ImGuiStats.h"
+
+static TSharedPtr<FImGuiFontAtlas> GImGui_SharedFontAtlas = nullptr;
+
+/// Bytes of the shared atlas in the font memory stat
+static int64 GImGui_SharedFontAtlasBytes = 0;
+
+static void* ImGui_MemAlloc(size_t Size, void* UserData)
+{
+	LLM_SCOPE_BYNAME(TEXT("ImGui"));
+	return FMemory::Malloc(Size);
+}
+
+static void ImGui_MemFree(void* Ptr, void* UserData)
+{
+	FMemory::Free(Ptr);
+}
+
+template <typename T>
+static int64 ImGui_GetBytes(const ImVector<T>& Vector)
+{
+	return static_cast<int64>(Vector.Capacity) * sizeof(T);
+}
+
+TSharedRef<FImGuiFontAtlas> FImGuiFontAtlas::GetShared()
+{
+	check(IsInGameThread());
+
+	if (!GImGui_SharedFontAtlas.IsValid())
+	{
+		// The atlas is the first thing ImGui allocates, and its build allocates from another thread
+		ImGui::SetAllocatorFunctions(ImGui_MemAlloc, ImGui_MemFree);
+
+		GImGui_SharedFontAtlas = MakeShared<FImGuiFontAtlas>();
+
+		const FString FontPath = FPaths::EngineContentDir() / TEXT("Slate/Fonts/Roboto-Regular.ttf");
+		GImGui_SharedFontAtlas->BuildTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [FontAtlas = GImGui_SharedFontAtlas.Get(), FontPath]()
+		{
+			// The atlas waits for the task before it is destroyed, and contexts before being created so that the build
+			// never runs while ImGui is used on the game thread
+			FontAtlas->Build(FontPath);
+		});
+	}
+
+	return GImGui_SharedFontAtlas.ToSharedRef();
+}
+
+void FImGuiFontAtlas::ReleaseShared()
+{
+	GImGui_SharedFontAtlas.Reset();
+}
+
+void FImGuiFontAtlas::ReleaseSharedIfModified()
+{
+	if (GImGui_SharedFontAtlas.IsValid() && GImGui_SharedFontAtlas->BuildTask.IsCompleted() &&
+		GImGui_SharedFontAtlas->Atlas.Fonts.Size > GImGui_SharedFontAtlas->BuiltFontCount)
+	{
+		GImGui_SharedFontAtlas.Reset();
+	}
+}
+
+void FImGuiFontAtlas::UpdateSharedMemory()
+{
+	int64 Bytes = 0;
+
+	// The atlas is only read once its build completed
+	if (GImGui_SharedFontAtlas.IsValid() && GImGui_SharedFontAtlas->BuildTask.IsCompleted())
+	{
+		const ImFontAtlas& Atlas = GImGui_SharedFontAtlas->Atlas;
+		const int64 TexturePixels = static_cast<int64>(Atlas.TexWidth) * Atlas.TexHeight;
+		Bytes += Atlas.TexPixelsAlpha8 ? TexturePixels : 0;
+		Bytes += Atlas.TexPixelsRGBA32 ? TexturePixels * sizeof(uint32) : 0;
+		Bytes += ImGui_GetBytes(Atlas.Fonts) + ImGui_GetBytes(Atlas.CustomRects) + ImGui_GetBytes(Atlas.ConfigData);
+
+		for (const ImFont* Font : Atlas.Fonts)
+		{
+			Bytes += sizeof(ImFont) + ImGui_GetBytes(Font->Glyphs) + ImGui_GetBytes(Font->IndexAdvanceX) + ImGui_GetBytes(Font->IndexLookup);
+		}
+
+		for (const ImFontConfig& Config : Atlas.ConfigData)
+		{
+			Bytes += Config.FontDataOwnedByAtlas ? Config.FontDataSize : 0;
+		}
+	}
+
+	IMGUI_UPDATE_MEMORY(MemoryFonts, GImGui_SharedFontAtlasBytes, Bytes);
+	GImGui_SharedFontAtlasBytes = Bytes;
+}
+
+FImGuiFontAtlas::~FImGuiFontAtlas()
+{
+	BuildTask.Wait();
+}
+
+ImFontAtlas* FImGuiFontAtlas::Get()
+{
+	return &Atlas;
+}
+
+uint32 FImGuiFontAtlas::GetGeneration() const
+{
+	return Generation;
+}
+
+void FImGuiFontAtlas::WaitForBuild()
+{
+	if (!BuildTask.IsCompleted())
+	{
+		// Only when a context is created right after the module started or the shared atlas was released
+		IMGUI_SCOPE_CYCLE_COUNTER(AtlasWait);
+		BuildTask.Wait();
+	}
+}
+
+void FImGuiFontAtlas::Build(const FString& FontPath)
+{
+	IMGUI_SCOPE_CYCLE_COUNTER(AtlasBuild);
+
+	Atlas.AddFontFromFileTTF(TCHAR_TO_ANSI(*FontPath), 16);
+
+	// Plot markers are drawn from sprites packed with the fonts
+	ImPlot::AddMarkerSprites(&Atlas, MarkerSprites);
+	BuiltFontCount = Atlas.Fonts.Size;
+
+	Rasterize();
+}
+
+void FImGuiFontAtlas::Rasterize()
+{
+	uint8* TextureDataRaw;
+	int32 TextureWidth, TextureHeight;
+	Atlas.GetTexDataAsRGBA32(&TextureDataRaw, &TextureWidth, &TextureHeight);
+	ImPlot::BuildMarkerSprites(&Atlas, MarkerSprites);
+}
+
+void FImGuiFontAtlas::Update()
+{
+	WaitForBuild();
+
+	if (Atlas.IsBuilt() && TexturePtr.IsValid())
+	{
+		return;
+	}
+
+	IMGUI_SCOPE_CYCLE_COUNTER(AtlasUpload);
+	IMGUI_INC_COUNTER(AtlasUploads, 1);
+
+	if (!Atlas.IsBuilt())
+	{
+		// Fonts were added by a context since the build
+		Rasterize();
+	}
+
+	uint8* TextureDataRaw;
+	int32 TextureWidth, TextureHeight, BytesPerPixel;
+	Atlas.GetTexDataAsRGBA32(&TextureDataRaw, &TextureWidth, &TextureHeight, &BytesPerPixel);
+
+#if WITH_ENGINE
+	UTexture2D* FontAtlasTexture = UTexture2D::CreateTransient(TextureWidth, TextureHeight, PF_R8G8B8A8, TEXT("ImGuiFontAtlas"));
+	FontAtlasTexture->Filter = TF_Bilinear;
+	FontAtlasTexture->AddressX = TA_Wrap;
+	FontAtlasTexture->AddressY = TA_Wrap;
+
+	uint8* FontAtlasTextureData = static_cast<uint8*>(FontAtlasTexture->GetPlatformData()->Mips[0].BulkData.Lock(LOCK_READ_WRITE));
+	FMemory::Memcpy(FontAtlasTextureData, TextureDataRaw, TextureWidth * TextureHeight * BytesPerPixel);
+	FontAtlasTexture->GetPlatformData()->Mips[0].BulkData.Unlock();
+	FontAtlasTexture->UpdateResource();
+
+	TexturePtr.Reset(FontAtlasTexture);
+#else
+	TexturePtr = FSlateDynamicImageBrush::CreateWithImageData(
+		TEXT("ImGuiFontAtlas"), FVector2D(TextureWidth, TextureHeight),
+		TArray(TextureDataRaw, TextureWidth * TextureHeight * BytesPerPixel));
+#endif
+
+	Atlas.SetTexID(TexturePtr.Get());
+	++Generation;
+}
+
+void FImGuiFontAtlas::ApplyMarkerSprites(ImPlotContext* PlotContext) const
+{
+	if (PlotContext)
+	{
+		PlotContext->MarkerSprites = MarkerSprites;
+	}
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Tasks/Task.h>
+#include <Templates/SharedPointer.h>
+
+#if WITH_ENGINE
+#include <Engine/Texture2D.h>
+#include <UObject/StrongObjectPtr.h>
+#endif
+
+THIRD_PARTY_INCLUDES_START
+#include <imgui.h>
+#include <implot_internal.h>
+THIRD_PARTY_INCLUDES_END
+
+struct FSlateBrush;
+
+/// Font atlas and plot marker sprites shared by ImGui contexts
+///
+/// Fonts are rasterized on a background task when the atlas is created, so module startup doesn't wait for it. Contexts
+/// wait for the task before being created, which only blocks when one is created right away, so fonts can be added to
+/// the atlas of a context as soon as it exists.
+class FImGuiFontAtlas
+{
+public:
+	/// Returns the atlas used by contexts unless given another, building it in the background the first time
+	static TSharedRef<FImGuiFontAtlas> GetShared();
+
+	/// Drops the shared atlas, contexts still using it keep it alive
+	static void ReleaseShared();
+
+	/// Drops the shared atlas if fonts were added to it since it was built, e.g. by a PIE session, so that they don't
+	/// pile up in the atlas of later sessions
+	static void ReleaseSharedIfModified();
+
+	/// Moves the font memory of "stat ImGui" and the ImGui channel to the bytes held by the shared atlas, called by the
+	/// module once per frame rather than by every context using the atlas
+	static void UpdateSharedMemory();
+
+	~FImGuiFontAtlas();
+
+	/// Returns the atlas to create contexts with, only modified by the build until WaitForBuild returns
+	ImFontAtlas* Get();
+
+	/// Blocks until the background build has completed
+	void WaitForBuild();
+
+	/// Waits for the background build, rebuilds the atlas if fonts were added since, and uploads it when needed
+	void Update();
+
+	/// Incremented every time the atlas is uploaded
+	uint32 GetGeneration() const;
+
+	/// Copies the marker sprites rasterized with the fonts into an ImPlot context, which draws markers from them
+	void ApplyMarkerSprites(ImPlotContext* PlotContext) const;
+
+private:
+	void Build(const FString& FontPath);
+	void Rasterize();
+
+	ImFontAtlas Atlas;
+	ImPlotMarkerSprites MarkerSprites;
+	UE::Tasks::FTask BuildTask;
+	uint32 Generation = 0;
+
+	/// Fonts in the atlas once built, more means fonts were added by a context since
+	int32 BuiltFontCount = 0;
+
+#if WITH_ENGINE
+	TStrongObjectPtr<UTexture2D> TexturePtr = nullptr;
+#else
+	TSharedPtr<FSlateBrush> TexturePtr = nullptr;
+#endif
+};
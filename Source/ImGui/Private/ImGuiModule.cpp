@@ -1,5 +1,6 @@
 ﻿#include "ImGuiModule.h"
 
+#include <Misc/CoreDelegates.h>
 #include <Widgets/SWindow.h>
 
 #if WITH_ENGINE
@@ -13,10 +14,28 @@
 #endif
 
 #include "ImGuiContext.h"
+#include "ImGuiDeferred.h"
+#include "ImGuiFontAtlas.h"
+#include "ImGuiStats.h"
 #include "SImGuiOverlay.h"
 
 void FImGuiModule::StartupModule()
 {
+	// Registered ahead of the contexts so the counters of a frame are traced before the next one begins
+	FlushFrameCountersHandle = FCoreDelegates::OnBeginFrame.AddStatic(&ImGuiStats::FlushFrameCounters);
+
+	// The shared font atlas is counted once rather than by every context using it
+	UpdateFontMemoryHandle = FCoreDelegates::OnBeginFrame.AddStatic(&FImGuiFontAtlas::UpdateSharedMemory);
+
+	// Deferred commands are recorded whether or not a context begins frames to replay them, e.g. a remote one without a client
+	TrimDeferredHandle = FCoreDelegates::OnEndFrame.AddLambda([]()
+	{
+		FImGuiDeferredScope::Trim(GFrameCounter);
+	});
+
+	// Contexts are only created when first drawn to, but rasterizing the fonts ahead of time keeps it off their first frame
+	FImGuiFontAtlas::GetShared();
+
 #if WITH_EDITOR
 	FEditorDelegates::EndPIE.AddRaw(this, &FImGuiModule::OnEndPIE);
 #endif
@@ -28,7 +47,15 @@ void FImGuiModule::ShutdownModule()
 	FEditorDelegates::EndPIE.RemoveAll(this);
 #endif
 
+	FCoreDelegates::OnBeginFrame.Remove(FlushFrameCountersHandle);
+	FCoreDelegates::OnBeginFrame.Remove(UpdateFontMemoryHandle);
+	FCoreDelegates::OnEndFrame.Remove(TrimDeferredHandle);
+
 	SessionContexts.Reset();
+	++SessionGeneration;
+
+	FImGuiFontAtlas::ReleaseShared();
+	FImGuiFontAtlas::UpdateSharedMemory();
 }
 
 FImGuiModule& FImGuiModule::Get()
@@ -83,6 +110,12 @@ TSharedPtr<FImGuiContext> FImGuiModule::FindOrCreateSessionContext(const int32 P
 
 		if (Context.IsValid())
 		{
+			int32 MemoryBudgetMB = 0;
+			if (FParse::Value(FCommandLine::Get(), TEXT("-ImGuiMemoryBudget="), MemoryBudgetMB))
+			{
+				Context->SetMemoryBudget(static_cast<int64>(MemoryBudgetMB) * 1024 * 1024);
+			}
+
 			if (bShouldConnect && !Context->Connect(Host, Port) || bShouldListen && !Context->Listen(Port))
 			{
 				Context.Reset();
@@ -98,9 +131,18 @@ TSharedPtr<FImGuiContext> FImGuiModule::FindOrCreateSessionContext(const int32 P
 	return Context;
 }
 
+uint32 FImGuiModule::GetSessionGeneration() const
+{
+	return SessionGeneration;
+}
+
 void FImGuiModule::OnEndPIE(bool bIsSimulating)
 {
 	SessionContexts.Reset();
+	++SessionGeneration;
+
+	// Fonts added by the session would otherwise remain in the atlas of the next ones
+	FImGuiFontAtlas::ReleaseSharedIfModified();
 }
 
 TSharedPtr<FImGuiContext> FImGuiModule::CreateWindowContext(const TSharedRef<SWindow>& Window)
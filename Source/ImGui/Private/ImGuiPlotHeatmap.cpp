@@ -0,0 +1,230 @@
+#include "ImGuiPlotHeatmap.h"
+
+#include <Async/ParallelFor.h>
+#include <Hash/xxhash.h>
+#include <Math/VectorRegister.h>
+
+#if !WITH_ENGINE
+#include <Brushes/SlateDynamicImageBrush.h>
+#endif
+
+THIRD_PARTY_INCLUDES_START
+#include <implot_internal.h>
+THIRD_PARTY_INCLUDES_END
+
+/// Number of colors sampled from the colormap, followed by a transparent color for NaNs
+static constexpr int32 GImGui_HeatmapLutSize = 1024;
+
+static VectorRegister4Float ImGui_LoadHeatmapValues(const float* Values)
+{
+	return VectorLoad(Values);
+}
+
+static VectorRegister4Float ImGui_LoadHeatmapValues(const double* Values)
+{
+	return MakeVectorRegisterFloatFromDouble(VectorLoad(Values));
+}
+
+/// Colormaps a run of values read with a stride, four contiguous values at a time
+template <typename T>
+static void ImGui_ColormapHeatmapValues(const T* Values, int32 Count, int32 Stride, uint32* OutPixels, const uint32* Lut, float Scale, float Bias)
+{
+	int32 Idx = 0;
+	if (Stride == 1)
+	{
+		const VectorRegister4Float ScaleV = VectorSetFloat1(Scale);
+		const VectorRegister4Float BiasV = VectorSetFloat1(Bias);
+		const VectorRegister4Float MaxIndexV = VectorSetFloat1(GImGui_HeatmapLutSize - 1);
+		const VectorRegister4Float NaNIndexV = VectorSetFloat1(GImGui_HeatmapLutSize);
+		for (; Idx + 4 <= Count; Idx += 4)
+		{
+			const VectorRegister4Float ValuesV = ImGui_LoadHeatmapValues(Values + Idx);
+			VectorRegister4Float IndicesV = VectorMultiplyAdd(ValuesV, ScaleV, BiasV);
+			IndicesV = VectorMin(VectorMax(IndicesV, VectorZeroFloat()), MaxIndexV);
+			IndicesV = VectorSelect(VectorCompareNE(ValuesV, ValuesV), NaNIndexV, IndicesV);
+
+			alignas(16) int32 Indices[4];
+			VectorIntStore(VectorFloatToInt(IndicesV), Indices);
+			OutPixels[Idx + 0] = Lut[Indices[0]];
+			OutPixels[Idx + 1] = Lut[Indices[1]];
+			OutPixels[Idx + 2] = Lut[Indices[2]];
+			OutPixels[Idx + 3] = Lut[Indices[3]];
+		}
+	}
+
+	for (; Idx < Count; ++Idx)
+	{
+		const float Value = static_cast<float>(Values[Idx * Stride]);
+		OutPixels[Idx] = FMath::IsNaN(Value) ? Lut[GImGui_HeatmapLutSize] : Lut[static_cast<int32>(FMath::Clamp(Value * Scale + Bias, 0.0f, GImGui_HeatmapLutSize - 1.0f))];
+	}
+}
+
+/// Returns the range of the values ignoring NaNs, like ImPlot::PlotHeatmap does when both scale bounds are 0
+template <typename T>
+static void ImGui_GetHeatmapRange(const T* Values, int32 Count, bool bParallel, double& OutMin, double& OutMax)
+{
+	constexpr int32 ChunkSize = 64 * 1024;
+	const int32 NumChunks = FMath::DivideAndRoundUp(Count, ChunkSize);
+
+	TArray<TPair<T, T>> ChunkRanges;
+	ChunkRanges.SetNumUninitialized(NumChunks);
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		T Min = TNumericLimits<T>::Max();
+		T Max = TNumericLimits<T>::Lowest();
+		const int32 ChunkEnd = FMath::Min((ChunkIdx + 1) * ChunkSize, Count);
+		for (int32 Idx = ChunkIdx * ChunkSize; Idx < ChunkEnd; ++Idx)
+		{
+			// Comparisons with NaN are false
+			Min = Values[Idx] < Min ? Values[Idx] : Min;
+			Max = Values[Idx] > Max ? Values[Idx] : Max;
+		}
+		ChunkRanges[ChunkIdx] = { Min, Max };
+	}, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+	OutMin = TNumericLimits<T>::Max();
+	OutMax = TNumericLimits<T>::Lowest();
+	for (const TPair<T, T>& ChunkRange : ChunkRanges)
+	{
+		OutMin = FMath::Min<double>(OutMin, ChunkRange.Key);
+		OutMax = FMath::Max<double>(OutMax, ChunkRange.Value);
+	}
+
+	if (OutMin > OutMax)
+	{
+		OutMin = OutMax = 0;
+	}
+}
+
+void FImGuiPlotHeatmap::Plot(const char* LabelId, const float* Values, int32 Rows, int32 Cols, double ScaleMin, double ScaleMax, const char* LabelFmt,
+	const ImPlotPoint& BoundsMin, const ImPlotPoint& BoundsMax, ImPlotHeatmapFlags Flags)
+{
+	PlotImpl(LabelId, Values, Rows, Cols, ScaleMin, ScaleMax, LabelFmt, BoundsMin, BoundsMax, Flags);
+}
+
+void FImGuiPlotHeatmap::Plot(const char* LabelId, const double* Values, int32 Rows, int32 Cols, double ScaleMin, double ScaleMax, const char* LabelFmt,
+	const ImPlotPoint& BoundsMin, const ImPlotPoint& BoundsMax, ImPlotHeatmapFlags Flags)
+{
+	PlotImpl(LabelId, Values, Rows, Cols, ScaleMin, ScaleMax, LabelFmt, BoundsMin, BoundsMax, Flags);
+}
+
+template <typename T>
+void FImGuiPlotHeatmap::PlotImpl(const char* LabelId, const T* Values, int32 Rows, int32 Cols, double ScaleMin, double ScaleMax, const char* LabelFmt,
+	const ImPlotPoint& BoundsMin, const ImPlotPoint& BoundsMax, ImPlotHeatmapFlags Flags)
+{
+	if (!ImPlot::BeginItem(LabelId))
+	{
+		return;
+	}
+
+	if (ImPlot::FitThisFrame())
+	{
+		ImPlot::FitPoint(BoundsMin);
+		ImPlot::FitPoint(BoundsMax);
+	}
+
+	if (Rows <= 0 || Cols <= 0)
+	{
+		ImPlot::EndItem();
+		return;
+	}
+
+	const int32 NumCells = Rows * Cols;
+	const bool bColMajor = ImHasFlag(Flags, ImPlotHeatmapFlags_ColMajor);
+	const ImPlotColormap Colormap = ImPlot::GetStyle().Colormap;
+	const uint64 Hash = bHashValues ? FXxHash64::HashBuffer(Values, NumCells * sizeof(T)).Hash : 0;
+
+	if (bDirty || (bHashValues ? Hash != ValuesHash : Values != ValuesPtr) || Rows != CachedRows || Cols != CachedCols || ScaleMin != CachedScaleMin
+		|| ScaleMax != CachedScaleMax || Colormap != CachedColormap || bColMajor != bCachedColMajor || !Texture.IsValid())
+	{
+		ResolvedScaleMin = ScaleMin;
+		ResolvedScaleMax = ScaleMax;
+		if (ScaleMin == 0 && ScaleMax == 0)
+		{
+			ImGui_GetHeatmapRange(Values, NumCells, NumCells >= ParallelCellThreshold, ResolvedScaleMin, ResolvedScaleMax);
+		}
+
+		UpdatePixels(Values, Rows, Cols, ResolvedScaleMin, ResolvedScaleMax, bColMajor);
+		UpdateTexture(Cols, Rows);
+
+		ValuesHash = Hash;
+		ValuesPtr = Values;
+		CachedRows = Rows;
+		CachedCols = Cols;
+		CachedScaleMin = ScaleMin;
+		CachedScaleMax = ScaleMax;
+		CachedColormap = Colormap;
+		bCachedColMajor = bColMajor;
+		bDirty = false;
+	}
+
+	// Row 0 is at the top like with ImPlot::PlotHeatmap
+	ImDrawList& DrawList = *ImPlot::GetPlotDrawList();
+	DrawList.AddImage(Texture.Get(), ImPlot::PlotToPixels(BoundsMin.x, BoundsMax.y), ImPlot::PlotToPixels(BoundsMax.x, BoundsMin.y));
+
+	if (LabelFmt && ResolvedScaleMin != ResolvedScaleMax)
+	{
+		ImPlot::RenderHeatmapLabels(DrawList, Values, Rows, Cols, ResolvedScaleMin, ResolvedScaleMax, LabelFmt, BoundsMin, BoundsMax, true, bColMajor);
+	}
+
+	ImPlot::EndItem();
+}
+
+template <typename T>
+void FImGuiPlotHeatmap::UpdatePixels(const T* Values, int32 Rows, int32 Cols, double ScaleMin, double ScaleMax, bool bColMajor)
+{
+	Pixels.SetNumUninitialized(Rows * Cols);
+
+	if (ScaleMin == ScaleMax)
+	{
+		// Same as ImPlot::PlotHeatmap, a single color without labels
+		const uint32 Color = ImPlot::GetColormapColorU32(0, ImPlot::GetStyle().Colormap);
+		for (uint32& Pixel : Pixels)
+		{
+			Pixel = Color;
+		}
+		return;
+	}
+
+	uint32 Lut[GImGui_HeatmapLutSize + 1];
+	for (int32 LutIdx = 0; LutIdx < GImGui_HeatmapLutSize; ++LutIdx)
+	{
+		Lut[LutIdx] = ImPlot::SampleColormapU32(LutIdx / static_cast<float>(GImGui_HeatmapLutSize - 1), ImPlot::GetStyle().Colormap);
+	}
+	Lut[GImGui_HeatmapLutSize] = 0;
+
+	// Rounds to the nearest color
+	const float Scale = static_cast<float>((GImGui_HeatmapLutSize - 1) / (ScaleMax - ScaleMin));
+	const float Bias = static_cast<float>(-ScaleMin * Scale + 0.5);
+
+	ParallelFor(Rows, [&](int32 Row)
+	{
+		const T* RowValues = bColMajor ? Values + Row : Values + Row * Cols;
+		ImGui_ColormapHeatmapValues(RowValues, Cols, bColMajor ? Rows : 1, Pixels.GetData() + Row * Cols, Lut, Scale, Bias);
+	}, Rows * Cols >= ParallelCellThreshold ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void FImGuiPlotHeatmap::UpdateTexture(int32 Width, int32 Height)
+{
+#if WITH_ENGINE
+	if (!Texture.IsValid() || Texture->GetSizeX() != Width || Texture->GetSizeY() != Height)
+	{
+		UTexture2D* NewTexture = UTexture2D::CreateTransient(Width, Height, PF_R8G8B8A8, TEXT("ImGuiPlotHeatmap"));
+		NewTexture->Filter = TF_Nearest;
+		NewTexture->AddressX = TA_Clamp;
+		NewTexture->AddressY = TA_Clamp;
+		Texture.Reset(NewTexture);
+	}
+
+	uint8* TextureData = static_cast<uint8*>(Texture->GetPlatformData()->Mips[0].BulkData.Lock(LOCK_READ_WRITE));
+	FMemory::Memcpy(TextureData, Pixels.GetData(), Pixels.Num() * Pixels.GetTypeSize());
+	Texture->GetPlatformData()->Mips[0].BulkData.Unlock();
+	Texture->UpdateResource();
+#else
+	// Dynamic brushes are keyed by name, a new name makes Slate pick up the new pixels
+	static int32 TextureCount = 0;
+	Texture = FSlateDynamicImageBrush::CreateWithImageData(
+		FName(TEXT("ImGuiPlotHeatmap"), ++TextureCount), FVector2D(Width, Height),
+		TArray(reinterpret_cast<const uint8*>(Pixels.GetData()), Pixels.Num() * Pixels.GetTypeSize()));
+#endif
+}
@@ -0,0 +1,167 @@
+#include "ImGuiRenderTarget.h"
+
+#if WITH_ENGINE
+#include <Engine/TextureRenderTarget2D.h>
+#include <Slate/WidgetRenderer.h>
+
+THIRD_PARTY_INCLUDES_START
+#include <imgui.h>
+THIRD_PARTY_INCLUDES_END
+
+#include "ImGuiContext.h"
+#include "ImGuiStats.h"
+#include "SImGuiOverlay.h"
+
+static FBox2f ImGui_GetDrawListBounds(const FImGuiDrawList& DrawList)
+{
+	// Conservative, everything a command draws is within its clip rect
+	FBox2f Bounds(ForceInit);
+	for (const ImDrawCmd& DrawCmd : DrawList.CmdBuffer)
+	{
+		if (DrawCmd.ElemCount > 0)
+		{
+			Bounds += FBox2f(FVector2f(DrawCmd.ClipRect.x, DrawCmd.ClipRect.y), FVector2f(DrawCmd.ClipRect.z, DrawCmd.ClipRect.w));
+		}
+	}
+
+	return Bounds;
+}
+
+TSharedRef<FImGuiRenderTarget> FImGuiRenderTarget::Create(const FIntPoint& Size, const TSharedPtr<FImGuiContext>& FontAtlasContext)
+{
+	TSharedRef<FImGuiRenderTarget> RenderTarget = MakeShared<FImGuiRenderTarget>();
+	RenderTarget->Initialize(Size, FontAtlasContext);
+
+	return RenderTarget;
+}
+
+void FImGuiRenderTarget::Initialize(const FIntPoint& InSize, const TSharedPtr<FImGuiContext>& FontAtlasContext)
+{
+	Size = InSize;
+
+	Context = FImGuiContext::Create(FontAtlasContext);
+
+	// Overlays given a context don't register for input
+	Overlay = SNew(SImGuiOverlay).Context(Context);
+
+	WidgetRenderer = MakeShared<FWidgetRenderer>(false, true);
+	RenderTargetPtr.Reset(FWidgetRenderer::CreateTargetFor(FVector2D(Size), TF_Bilinear, false));
+
+	ImGui::FScopedContext ScopedContext(Context);
+
+	ImGuiIO& IO = ImGui::GetIO();
+
+	// Only the main viewport is presented, and the layouts of many panels aren't worth saving to a shared ini file
+	IO.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+	IO.IniFilename = nullptr;
+
+	FImGuiViewportData* ViewportData = FImGuiViewportData::GetOrCreate(ImGui::GetMainViewport());
+	if (ViewportData)
+	{
+		ViewportData->RenderTarget = AsShared();
+	}
+}
+
+TSharedPtr<FImGuiContext> FImGuiRenderTarget::GetContext() const
+{
+	return Context;
+}
+
+UTextureRenderTarget2D* FImGuiRenderTarget::GetRenderTarget() const
+{
+	return RenderTargetPtr.Get();
+}
+
+FIntPoint FImGuiRenderTarget::GetSize() const
+{
+	return Size;
+}
+
+int32 FImGuiRenderTarget::GetUpdateCount() const
+{
+	return UpdateCount;
+}
+
+FIntRect FImGuiRenderTarget::GetDirtyRect() const
+{
+	return DirtyRect;
+}
+
+int32 FImGuiRenderTarget::GetVertexCount() const
+{
+	return VertexCount;
+}
+
+int32 FImGuiRenderTarget::GetIndexCount() const
+{
+	return IndexCount;
+}
+
+void FImGuiRenderTarget::SetDrawData(const ImDrawData* InDrawData)
+{
+	if (!InDrawData || !InDrawData->Valid)
+	{
+		return;
+	}
+
+	// Takes the buffers of the draw lists like the Slate overlays do
+	FImGuiDrawData DrawData(InDrawData);
+
+	TArray<FDrawListState> NewDrawLists;
+	NewDrawLists.Reserve(DrawData.DrawLists.Num());
+	for (const FImGuiDrawList& DrawList : DrawData.DrawLists)
+	{
+		NewDrawLists.Add({ DrawList.Hash, ImGui_GetDrawListBounds(DrawList) });
+	}
+
+	// Draw lists which changed, appeared, or disappeared dirty both their previous and new areas
+	FBox2f DirtyBounds(ForceInit);
+	for (int32 ListIdx = 0; ListIdx < FMath::Max(NewDrawLists.Num(), DrawLists.Num()); ++ListIdx)
+	{
+		const FDrawListState* PrevDrawList = DrawLists.IsValidIndex(ListIdx) ? &DrawLists[ListIdx] : nullptr;
+		const FDrawListState* NextDrawList = NewDrawLists.IsValidIndex(ListIdx) ? &NewDrawLists[ListIdx] : nullptr;
+		if (PrevDrawList && NextDrawList && PrevDrawList->Hash == NextDrawList->Hash)
+		{
+			continue;
+		}
+
+		if (PrevDrawList)
+		{
+			DirtyBounds += PrevDrawList->Bounds;
+		}
+
+		if (NextDrawList)
+		{
+			DirtyBounds += NextDrawList->Bounds;
+		}
+	}
+
+	DrawLists = MoveTemp(NewDrawLists);
+
+	DirtyRect = FIntRect();
+	if (DirtyBounds.bIsValid)
+	{
+		const FVector2f Min = DirtyBounds.Min - DrawData.DisplayPos;
+		const FVector2f Max = DirtyBounds.Max - DrawData.DisplayPos;
+		DirtyRect = FIntRect(FMath::FloorToInt32(Min.X), FMath::FloorToInt32(Min.Y), FMath::CeilToInt32(Max.X), FMath::CeilToInt32(Max.Y));
+		DirtyRect.Clip(FIntRect(FIntPoint::ZeroValue, Size));
+	}
+
+	if (DirtyRect.Width() <= 0 || DirtyRect.Height() <= 0)
+	{
+		DirtyRect = FIntRect();
+		return;
+	}
+
+	IMGUI_SCOPE_CYCLE_COUNTER(RenderTargetDraw);
+	IMGUI_INC_COUNTER(RenderTargetUpdates, 1);
+
+	VertexCount = DrawData.TotalVtxCount;
+	IndexCount = DrawData.TotalIdxCount;
+	++UpdateCount;
+
+	// The whole target is redrawn as Slate can't blend translucent draw lists over only part of the previous contents
+	Overlay->SetDrawData(MoveTemp(DrawData));
+	WidgetRenderer->DrawWidget(RenderTargetPtr.Get(), Overlay.ToSharedRef(), FVector2D(Size), 0.0f);
+}
+#endif
@@ -0,0 +1,432 @@
+#include "ImGuiSortedTable.h"
+
+#include <Algo/BinarySearch.h>
+#include <Algo/Sort.h>
+#include <Async/ParallelFor.h>
+#include <Containers/BitArray.h>
+#include <Tasks/Task.h>
+
+THIRD_PARTY_INCLUDES_START
+#include <imgui.h>
+THIRD_PARTY_INCLUDES_END
+
+static bool ImGui_SortSpecsEqual(const TArray<ImGuiTableColumnSortSpecs>& A, const TArray<ImGuiTableColumnSortSpecs>& B)
+{
+	if (A.Num() != B.Num())
+	{
+		return false;
+	}
+
+	for (int32 Idx = 0; Idx < A.Num(); ++Idx)
+	{
+		if (A[Idx].ColumnUserID != B[Idx].ColumnUserID || A[Idx].ColumnIndex != B[Idx].ColumnIndex || A[Idx].SortDirection != B[Idx].SortDirection)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/// Row order for one set of sort specs
+struct FImGuiSortedTable::FCachedOrder
+{
+	TArray<ImGuiTableColumnSortSpecs> Specs;
+
+	/// Sorted rows, null until the first sort finished
+	TSharedPtr<const TArray<int32>> Rows;
+
+	/// Rows invalidated since the order was sorted
+	TArray<int32> DirtyRows;
+
+	/// Set once merging the invalidated rows would cost more than sorting everything again
+	bool bNeedsFullSort = false;
+
+	uint64 LastUsed = 0;
+};
+
+/// Sorts all rows with a parallel merge sort, or merges changed rows into a previous order
+struct FImGuiSortedTable::FSortJob
+{
+	static constexpr int32 MinRowsPerChunk = 8 * 1024;
+
+	bool Less(int32 RowA, int32 RowB) const
+	{
+		for (const ImGuiTableColumnSortSpecs& Column : Specs)
+		{
+			const int32 Order = CompareRows(Column, RowA, RowB);
+			if (Order != 0)
+			{
+				return Column.SortDirection == ImGuiSortDirection_Descending ? Order > 0 : Order < 0;
+			}
+		}
+
+		// Ties are broken by row index so every row has a unique position, which the parallel merge relies on
+		return RowA < RowB;
+	}
+
+	void Run()
+	{
+		if (BaseRows.IsValid())
+		{
+			MergeChangedRows();
+		}
+		else
+		{
+			SortAllRows();
+		}
+
+		bDone = !bCancel;
+	}
+
+	void MergeChangedRows()
+	{
+		const auto LessFn = [this](int32 RowA, int32 RowB) { return Less(RowA, RowB); };
+
+		// Rows appended since the previous sort count as changed
+		TBitArray<> IsChanged(false, RowCount);
+		TArray<int32> ChangedRows;
+		for (const int32 Row : DirtyRows)
+		{
+			if (Row >= 0 && Row < BaseRows->Num() && !IsChanged[Row])
+			{
+				IsChanged[Row] = true;
+				ChangedRows.Add(Row);
+			}
+		}
+		for (int32 Row = BaseRows->Num(); Row < RowCount; ++Row)
+		{
+			ChangedRows.Add(Row);
+		}
+
+		// Unchanged rows keep their relative order
+		TArray<int32> KeptRows;
+		KeptRows.Reserve(BaseRows->Num());
+		for (const int32 Row : *BaseRows)
+		{
+			if (!IsChanged[Row])
+			{
+				KeptRows.Add(Row);
+			}
+		}
+
+		Algo::Sort(ChangedRows, LessFn);
+
+		Result.Reserve(RowCount);
+		int32 KeptIdx = 0;
+		for (const int32 Row : ChangedRows)
+		{
+			if (bCancel)
+			{
+				return;
+			}
+
+			TArrayView<int32> RemainingRows = MakeArrayView(KeptRows).RightChop(KeptIdx);
+			const int32 InsertIdx = KeptIdx + Algo::LowerBound(RemainingRows, Row, LessFn);
+			Result.Append(KeptRows.GetData() + KeptIdx, InsertIdx - KeptIdx);
+			Result.Add(Row);
+			KeptIdx = InsertIdx;
+		}
+		Result.Append(KeptRows.GetData() + KeptIdx, KeptRows.Num() - KeptIdx);
+	}
+
+	void SortAllRows()
+	{
+		const auto LessFn = [this](int32 RowA, int32 RowB) { return Less(RowA, RowB); };
+
+		Result.SetNumUninitialized(RowCount);
+		for (int32 Row = 0; Row < RowCount; ++Row)
+		{
+			Result[Row] = Row;
+		}
+
+		const int32 ChunkCount = FMath::Clamp(RowCount / MinRowsPerChunk, 1, FPlatformMisc::NumberOfWorkerThreadsToSpawn() * 2);
+		const auto ChunkBegin = [this, ChunkCount](int32 ChunkIdx) { return (int32)((int64)RowCount * FMath::Min(ChunkIdx, ChunkCount) / ChunkCount); };
+
+		// Chunks not yet started when the sort is cancelled are skipped
+		ParallelFor(ChunkCount, [&](int32 ChunkIdx)
+		{
+			if (!bCancel)
+			{
+				Algo::Sort(MakeArrayView(Result.GetData() + ChunkBegin(ChunkIdx), ChunkBegin(ChunkIdx + 1) - ChunkBegin(ChunkIdx)), LessFn);
+			}
+		});
+
+		// Merge sorted runs pairwise, each merge being split into segments so that every round keeps all workers busy
+		TArray<int32> Scratch;
+		Scratch.SetNumUninitialized(RowCount);
+		int32* Src = Result.GetData();
+		int32* Dst = Scratch.GetData();
+
+		for (int32 Width = 1; Width < ChunkCount && !bCancel; Width *= 2)
+		{
+			const int32 MergeCount = FMath::DivideAndRoundUp(ChunkCount, Width * 2);
+			const int32 SegmentCount = FMath::Max(ChunkCount / MergeCount, 1);
+
+			ParallelFor(MergeCount * SegmentCount, [&](int32 TaskIdx)
+			{
+				const int32 MergeIdx = TaskIdx / SegmentCount;
+				const int32 SegmentIdx = TaskIdx % SegmentCount;
+				const int32 Begin = ChunkBegin(MergeIdx * Width * 2);
+				const int32 Mid = ChunkBegin(MergeIdx * Width * 2 + Width);
+				const int32 End = ChunkBegin(MergeIdx * Width * 2 + Width * 2);
+
+				const int32* A = Src + Begin;
+				const int32* B = Src + Mid;
+				const int32 NumA = Mid - Begin;
+				const int32 NumB = End - Mid;
+
+				// Number of rows taken from A in the first OutIdx merged rows
+				const auto CoRank = [&](int32 OutIdx)
+				{
+					int32 Low = FMath::Max(0, OutIdx - NumB);
+					int32 High = FMath::Min(OutIdx, NumA);
+					while (Low < High)
+					{
+						const int32 IdxA = (Low + High) / 2;
+						if (Less(A[IdxA], B[OutIdx - IdxA - 1]))
+						{
+							Low = IdxA + 1;
+						}
+						else
+						{
+							High = IdxA;
+						}
+					}
+					return Low;
+				};
+
+				const int32 OutBegin = (int32)((int64)(NumA + NumB) * SegmentIdx / SegmentCount);
+				const int32 OutEnd = (int32)((int64)(NumA + NumB) * (SegmentIdx + 1) / SegmentCount);
+				int32 IdxA = CoRank(OutBegin);
+				int32 IdxB = OutBegin - IdxA;
+				const int32 EndA = CoRank(OutEnd);
+				const int32 EndB = OutEnd - EndA;
+
+				int32* Out = Dst + Begin + OutBegin;
+				while (IdxA < EndA && IdxB < EndB)
+				{
+					*Out++ = Less(B[IdxB], A[IdxA]) ? B[IdxB++] : A[IdxA++];
+				}
+				while (IdxA < EndA)
+				{
+					*Out++ = A[IdxA++];
+				}
+				while (IdxB < EndB)
+				{
+					*Out++ = B[IdxB++];
+				}
+			});
+
+			Swap(Src, Dst);
+		}
+
+		if (Src != Result.GetData())
+		{
+			Result = MoveTemp(Scratch);
+		}
+	}
+
+	TSharedPtr<FCachedOrder> Order;
+	TArray<ImGuiTableColumnSortSpecs> Specs;
+	FCompareRows CompareRows;
+	int32 RowCount = 0;
+
+	/// Order to merge the dirty and appended rows into, null to sort all rows
+	TSharedPtr<const TArray<int32>> BaseRows;
+	TArray<int32> DirtyRows;
+
+	TArray<int32> Result;
+	UE::Tasks::FTask Task;
+	std::atomic<bool> bCancel = false;
+	std::atomic<bool> bDone = false;
+};
+
+FImGuiSortedTable::FImGuiSortedTable(FCompareRows InCompareRows)
+	: CompareRows(MoveTemp(InCompareRows))
+{
+}
+
+FImGuiSortedTable::~FImGuiSortedTable()
+{
+	// Jobs compare rows through the owner's data, which must outlive them
+	CancelSort();
+	for (const TSharedRef<FSortJob>& CancelledJob : CancelledJobs)
+	{
+		CancelledJob->Task.Wait();
+	}
+}
+
+void FImGuiSortedTable::Update(int32 RowCount)
+{
+	++UpdateCount;
+	CollectSort();
+
+	TArray<ImGuiTableColumnSortSpecs> Specs;
+	if (ImGuiTableSortSpecs* SortSpecs = ImGui::TableGetSortSpecs())
+	{
+		Specs.Append(SortSpecs->Specs, SortSpecs->SpecsCount);
+		SortSpecs->SpecsDirty = false;
+	}
+
+	TSharedRef<FCachedOrder>* FoundOrder = CachedOrders.FindByPredicate([&Specs](const TSharedRef<FCachedOrder>& CachedOrder)
+	{
+		return ImGui_SortSpecsEqual(CachedOrder->Specs, Specs);
+	});
+
+	if (!FoundOrder)
+	{
+		while (CachedOrders.Num() > 0 && CachedOrders.Num() >= MaxCachedOrders)
+		{
+			int32 OldestIdx = 0;
+			for (int32 Idx = 1; Idx < CachedOrders.Num(); ++Idx)
+			{
+				OldestIdx = CachedOrders[Idx]->LastUsed < CachedOrders[OldestIdx]->LastUsed ? Idx : OldestIdx;
+			}
+			CachedOrders.RemoveAt(OldestIdx);
+		}
+
+		const TSharedRef<FCachedOrder> NewOrder = MakeShared<FCachedOrder>();
+		NewOrder->Specs = MoveTemp(Specs);
+		FoundOrder = &CachedOrders.Add_GetRef(NewOrder);
+	}
+
+	const TSharedRef<FCachedOrder> Order = *FoundOrder;
+	Order->LastUsed = UpdateCount;
+
+	const bool bNeedsSort = !Order->Rows.IsValid() || Order->Rows->Num() != RowCount || Order->DirtyRows.Num() > 0 || Order->bNeedsFullSort;
+	const bool bIsSorting = Job.IsValid() && Job->Order == Order;
+	if (bNeedsSort && !bIsSorting)
+	{
+		CancelSort();
+		StartSort(Order, RowCount);
+	}
+
+	// Until the current order is available the previous one remains visible
+	if (Order->Rows.IsValid())
+	{
+		DisplayedRows = Order->Rows;
+	}
+}
+
+void FImGuiSortedTable::InvalidateRows(TConstArrayView<int32> Rows)
+{
+	for (const TSharedRef<FCachedOrder>& Order : CachedOrders)
+	{
+		if (Order->bNeedsFullSort)
+		{
+			continue;
+		}
+
+		// Past a point sorting everything again is cheaper than merging
+		if (Order->DirtyRows.Num() + Rows.Num() > FMath::Max(Order->Rows.IsValid() ? Order->Rows->Num() / 4 : 0, 1024))
+		{
+			Order->bNeedsFullSort = true;
+			Order->DirtyRows.Empty();
+			continue;
+		}
+
+		Order->DirtyRows.Append(Rows.GetData(), Rows.Num());
+	}
+}
+
+void FImGuiSortedTable::Reset()
+{
+	CancelSort();
+	CachedOrders.Reset();
+	DisplayedRows.Reset();
+}
+
+void FImGuiSortedTable::Wait()
+{
+	if (Job.IsValid() && Job->Task.IsValid())
+	{
+		Job->Task.Wait();
+	}
+	for (const TSharedRef<FSortJob>& CancelledJob : CancelledJobs)
+	{
+		CancelledJob->Task.Wait();
+	}
+	CollectSort();
+}
+
+bool FImGuiSortedTable::IsSorting() const
+{
+	return Job.IsValid() || CancelledJobs.Num() > 0;
+}
+
+void FImGuiSortedTable::DrawRows(TFunctionRef<void(int32 RowIndex)> DrawRow) const
+{
+	ImGuiListClipper Clipper;
+	Clipper.Begin(Num());
+	while (Clipper.Step())
+	{
+		for (int32 DisplayIdx = Clipper.DisplayStart; DisplayIdx < Clipper.DisplayEnd; ++DisplayIdx)
+		{
+			DrawRow((*DisplayedRows)[DisplayIdx]);
+		}
+	}
+}
+
+void FImGuiSortedTable::StartSort(const TSharedRef<FCachedOrder>& Order, int32 RowCount)
+{
+	Job = MakeShared<FSortJob>();
+	Job->Order = Order;
+	Job->Specs = Order->Specs;
+	Job->CompareRows = CompareRows;
+	Job->RowCount = RowCount;
+	Job->DirtyRows = MoveTemp(Order->DirtyRows);
+	if (!Order->bNeedsFullSort && Order->Rows.IsValid() && Order->Rows->Num() <= RowCount && (RowCount - Order->Rows->Num()) <= RowCount / 4)
+	{
+		Job->BaseRows = Order->Rows;
+	}
+	Order->bNeedsFullSort = false;
+
+	if (RowCount < AsyncRowThreshold)
+	{
+		Job->Run();
+	}
+	else
+	{
+		Job->Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, [SortJob = Job.ToSharedRef()]() { SortJob->Run(); });
+	}
+
+	CollectSort();
+}
+
+void FImGuiSortedTable::CancelSort()
+{
+	if (!Job.IsValid())
+	{
+		return;
+	}
+
+	CollectSort();
+	if (!Job.IsValid())
+	{
+		return;
+	}
+
+	// The job owns everything it works on, it is dropped once it noticed the cancellation rather than waited for
+	Job->bCancel = true;
+	CancelledJobs.Add(Job.ToSharedRef());
+
+	// The rows still need to be moved into place next time this order is used, the job only reads them
+	Job->Order->DirtyRows.Append(Job->DirtyRows);
+	Job->Order->bNeedsFullSort |= !Job->BaseRows.IsValid();
+	Job.Reset();
+}
+
+void FImGuiSortedTable::CollectSort()
+{
+	if (Job.IsValid() && Job->bDone)
+	{
+		Job->Order->Rows = MakeShared<const TArray<int32>>(MoveTemp(Job->Result));
+		Job.Reset();
+	}
+
+	CancelledJobs.RemoveAll([](const TSharedRef<FSortJob>& CancelledJob)
+	{
+		return CancelledJob->Task.IsCompleted();
+	});
+}
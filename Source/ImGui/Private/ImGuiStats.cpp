@@ -0,0 +1,126 @@
+#include "ImGuiStats.h"
+
+#include <HAL/PlatformTime.h>
+
+UE_TRACE_CHANNEL_DEFINE(ImGuiChannel)
+
+DEFINE_STAT(STAT_ImGui_BeginFrame);
+DEFINE_STAT(STAT_ImGui_UpdateMemory);
+DEFINE_STAT(STAT_ImGui_AtlasBuild);
+DEFINE_STAT(STAT_ImGui_AtlasWait);
+DEFINE_STAT(STAT_ImGui_AtlasUpload);
+DEFINE_STAT(STAT_ImGui_EndFrame);
+DEFINE_STAT(STAT_ImGui_ReplayDeferred);
+DEFINE_STAT(STAT_ImGui_Render);
+DEFINE_STAT(STAT_ImGui_UpdatePlatformWindows);
+DEFINE_STAT(STAT_ImGui_RenderPlatformWindows);
+DEFINE_STAT(STAT_ImGui_Paint);
+DEFINE_STAT(STAT_ImGui_RenderTargetDraw);
+DEFINE_STAT(STAT_ImGui_NetImguiConvertDrawFrame);
+DEFINE_STAT(STAT_ImGui_NetImguiCompressDrawFrame);
+
+DEFINE_STAT(STAT_ImGui_Widgets);
+DEFINE_STAT(STAT_ImGui_Vertices);
+DEFINE_STAT(STAT_ImGui_Indices);
+DEFINE_STAT(STAT_ImGui_DrawCommands);
+DEFINE_STAT(STAT_ImGui_DrawLists);
+DEFINE_STAT(STAT_ImGui_SlateElements);
+DEFINE_STAT(STAT_ImGui_NetImguiBytesSent);
+DEFINE_STAT(STAT_ImGui_AtlasUploads);
+DEFINE_STAT(STAT_ImGui_RenderTargetUpdates);
+DEFINE_STAT(STAT_ImGui_MemoryCompactions);
+DEFINE_STAT(STAT_ImGui_MemoryDrawLists);
+DEFINE_STAT(STAT_ImGui_MemoryTables);
+DEFINE_STAT(STAT_ImGui_MemoryStorage);
+DEFINE_STAT(STAT_ImGui_MemoryTextBuffers);
+DEFINE_STAT(STAT_ImGui_MemoryFonts);
+DEFINE_STAT(STAT_ImGui_MemoryPlotItems);
+
+TRACE_DECLARE_INT_COUNTER(ImGui_Widgets, TEXT("ImGui/Widgets (us)"));
+TRACE_DECLARE_INT_COUNTER(ImGui_Vertices, TEXT("ImGui/Vertices"));
+TRACE_DECLARE_INT_COUNTER(ImGui_Indices, TEXT("ImGui/Indices"));
+TRACE_DECLARE_INT_COUNTER(ImGui_DrawCommands, TEXT("ImGui/Draw Commands"));
+TRACE_DECLARE_INT_COUNTER(ImGui_DrawLists, TEXT("ImGui/Draw Lists"));
+TRACE_DECLARE_INT_COUNTER(ImGui_SlateElements, TEXT("ImGui/Slate Elements"));
+TRACE_DECLARE_INT_COUNTER(ImGui_NetImguiBytesSent, TEXT("ImGui/NetImgui Bytes Sent"));
+TRACE_DECLARE_INT_COUNTER(ImGui_AtlasUploads, TEXT("ImGui/Atlas Uploads"));
+TRACE_DECLARE_INT_COUNTER(ImGui_RenderTargetUpdates, TEXT("ImGui/Render Target Updates"));
+TRACE_DECLARE_INT_COUNTER(ImGui_MemoryCompactions, TEXT("ImGui/Memory Compactions"));
+TRACE_DECLARE_MEMORY_COUNTER(ImGui_MemoryDrawLists, TEXT("ImGui/Memory/Draw Lists"));
+TRACE_DECLARE_MEMORY_COUNTER(ImGui_MemoryTables, TEXT("ImGui/Memory/Tables"));
+TRACE_DECLARE_MEMORY_COUNTER(ImGui_MemoryStorage, TEXT("ImGui/Memory/Storage"));
+TRACE_DECLARE_MEMORY_COUNTER(ImGui_MemoryTextBuffers, TEXT("ImGui/Memory/Text Buffers"));
+TRACE_DECLARE_MEMORY_COUNTER(ImGui_MemoryFonts, TEXT("ImGui/Memory/Fonts"));
+TRACE_DECLARE_MEMORY_COUNTER(ImGui_MemoryPlotItems, TEXT("ImGui/Memory/Plot Items"));
+
+std::atomic<int64> ImGuiStats::FrameCounters[static_cast<int32>(EImGuiCounter::Num)] = {};
+
+/// Nesting of the widget scopes on the game thread, only the outermost one is timed
+static int32 GImGui_WidgetsDepth = 0;
+static uint64 GImGui_WidgetsStartCycles = 0;
+static bool GImGui_WidgetsTraced = false;
+
+void ImGuiStats::FlushFrameCounters()
+{
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(ImGuiChannel))
+	{
+		return;
+	}
+
+	auto Exchange = [](EImGuiCounter Counter) { return FrameCounters[static_cast<int32>(Counter)].exchange(0, std::memory_order_relaxed); };
+
+	TRACE_COUNTER_SET(ImGui_Widgets, Exchange(EImGuiCounter::Widgets));
+	TRACE_COUNTER_SET(ImGui_Vertices, Exchange(EImGuiCounter::Vertices));
+	TRACE_COUNTER_SET(ImGui_Indices, Exchange(EImGuiCounter::Indices));
+	TRACE_COUNTER_SET(ImGui_DrawCommands, Exchange(EImGuiCounter::DrawCommands));
+	TRACE_COUNTER_SET(ImGui_DrawLists, Exchange(EImGuiCounter::DrawLists));
+	TRACE_COUNTER_SET(ImGui_SlateElements, Exchange(EImGuiCounter::SlateElements));
+	TRACE_COUNTER_SET(ImGui_NetImguiBytesSent, Exchange(EImGuiCounter::NetImguiBytesSent));
+	TRACE_COUNTER_SET(ImGui_AtlasUploads, Exchange(EImGuiCounter::AtlasUploads));
+	TRACE_COUNTER_SET(ImGui_RenderTargetUpdates, Exchange(EImGuiCounter::RenderTargetUpdates));
+	TRACE_COUNTER_SET(ImGui_MemoryCompactions, Exchange(EImGuiCounter::MemoryCompactions));
+	TRACE_COUNTER_SET(ImGui_MemoryDrawLists, Exchange(EImGuiCounter::MemoryDrawLists));
+	TRACE_COUNTER_SET(ImGui_MemoryTables, Exchange(EImGuiCounter::MemoryTables));
+	TRACE_COUNTER_SET(ImGui_MemoryStorage, Exchange(EImGuiCounter::MemoryStorage));
+	TRACE_COUNTER_SET(ImGui_MemoryTextBuffers, Exchange(EImGuiCounter::MemoryTextBuffers));
+	TRACE_COUNTER_SET(ImGui_MemoryFonts, Exchange(EImGuiCounter::MemoryFonts));
+	TRACE_COUNTER_SET(ImGui_MemoryPlotItems, Exchange(EImGuiCounter::MemoryPlotItems));
+}
+
+void ImGuiStats::BeginWidgets()
+{
+	if (!IsInGameThread() || GImGui_WidgetsDepth++ > 0)
+	{
+		return;
+	}
+
+	GImGui_WidgetsStartCycles = FPlatformTime::Cycles64();
+
+#if CPUPROFILERTRACE_ENABLED
+	GImGui_WidgetsTraced = UE_TRACE_CHANNELEXPR_IS_ENABLED(ImGuiChannel);
+	if (GImGui_WidgetsTraced)
+	{
+		FCpuProfilerTrace::OutputBeginDynamicEvent(TEXT("ImGui::Widgets"));
+	}
+#endif
+}
+
+void ImGuiStats::EndWidgets()
+{
+	if (!IsInGameThread() || --GImGui_WidgetsDepth > 0)
+	{
+		return;
+	}
+
+#if CPUPROFILERTRACE_ENABLED
+	if (GImGui_WidgetsTraced)
+	{
+		FCpuProfilerTrace::OutputEndEvent();
+		GImGui_WidgetsTraced = false;
+	}
+#endif
+
+	const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - GImGui_WidgetsStartCycles);
+	INC_FLOAT_STAT_BY(STAT_ImGui_Widgets, Seconds * 1000.0);
+	AddFrameCounter(EImGuiCounter::Widgets, static_cast<int64>(Seconds * 1000000.0));
+}
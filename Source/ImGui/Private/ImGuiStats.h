@@ -0,0 +1,124 @@
+#pragma once
+
+#include <ProfilingDebugging/CountersTrace.h>
+#include <ProfilingDebugging/CpuProfilerTrace.h>
+#include <Stats/Stats.h>
+#include <Trace/Trace.h>
+
+#include <atomic>
+
+/// Trace channel for the stages of the ImGui pipeline, off by default; enable with -trace=default,ImGui or "Trace.Enable ImGui"
+UE_TRACE_CHANNEL_EXTERN(ImGuiChannel)
+
+DECLARE_STATS_GROUP(TEXT("ImGui"), STATGROUP_ImGui, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Begin Frame"), STAT_ImGui_BeginFrame, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Memory"), STAT_ImGui_UpdateMemory, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Atlas Build"), STAT_ImGui_AtlasBuild, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Atlas Wait"), STAT_ImGui_AtlasWait, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Atlas Upload"), STAT_ImGui_AtlasUpload, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("End Frame"), STAT_ImGui_EndFrame, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Replay Deferred"), STAT_ImGui_ReplayDeferred, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Render"), STAT_ImGui_Render, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Platform Windows"), STAT_ImGui_UpdatePlatformWindows, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Render Platform Windows"), STAT_ImGui_RenderPlatformWindows, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Paint"), STAT_ImGui_Paint, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Render Target Draw"), STAT_ImGui_RenderTargetDraw, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("NetImgui Convert"), STAT_ImGui_NetImguiConvertDrawFrame, STATGROUP_ImGui, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("NetImgui Compress"), STAT_ImGui_NetImguiCompressDrawFrame, STATGROUP_ImGui, );
+
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Widgets (ms)"), STAT_ImGui_Widgets, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Vertices"), STAT_ImGui_Vertices, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Indices"), STAT_ImGui_Indices, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Draw Commands"), STAT_ImGui_DrawCommands, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Draw Lists"), STAT_ImGui_DrawLists, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Slate Elements"), STAT_ImGui_SlateElements, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("NetImgui Bytes Sent"), STAT_ImGui_NetImguiBytesSent, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Atlas Uploads"), STAT_ImGui_AtlasUploads, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Render Target Updates"), STAT_ImGui_RenderTargetUpdates, STATGROUP_ImGui, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Memory Compactions"), STAT_ImGui_MemoryCompactions, STATGROUP_ImGui, );
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Draw List Memory"), STAT_ImGui_MemoryDrawLists, STATGROUP_ImGui, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Table Memory"), STAT_ImGui_MemoryTables, STATGROUP_ImGui, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Storage Memory"), STAT_ImGui_MemoryStorage, STATGROUP_ImGui, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Text Buffer Memory"), STAT_ImGui_MemoryTextBuffers, STATGROUP_ImGui, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Font Memory"), STAT_ImGui_MemoryFonts, STATGROUP_ImGui, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Plot Item Memory"), STAT_ImGui_MemoryPlotItems, STATGROUP_ImGui, );
+
+/// Counters of the ImGui trace channel, summed over a frame
+enum class EImGuiCounter : uint8
+{
+	Widgets,
+	Vertices,
+	Indices,
+	DrawCommands,
+	DrawLists,
+	SlateElements,
+	NetImguiBytesSent,
+	AtlasUploads,
+	RenderTargetUpdates,
+	MemoryCompactions,
+	MemoryDrawLists,
+	MemoryTables,
+	MemoryStorage,
+	MemoryTextBuffers,
+	MemoryFonts,
+	MemoryPlotItems,
+	Num
+};
+
+namespace ImGuiStats
+{
+	extern std::atomic<int64> FrameCounters[static_cast<int32>(EImGuiCounter::Num)];
+
+	/// Returns true while "stat ImGui" or the ImGui channel collect data, so measurements only they need can be skipped
+	FORCEINLINE bool IsCollecting()
+	{
+#if STATS
+		if (FThreadStats::IsCollectingData())
+		{
+			return true;
+		}
+#endif
+		return UE_TRACE_CHANNELEXPR_IS_ENABLED(ImGuiChannel);
+	}
+
+	/// Adds to a counter of the current frame, only while the ImGui channel is enabled
+	FORCEINLINE void AddFrameCounter(EImGuiCounter Counter, int64 Amount)
+	{
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(ImGuiChannel))
+		{
+			FrameCounters[static_cast<int32>(Counter)].fetch_add(Amount, std::memory_order_relaxed);
+		}
+	}
+
+	/// Traces the counters of the last frame and resets them, called at the start of every engine frame
+	void FlushFrameCounters();
+
+	/// Times the widget code of the outermost FScopedContext scopes of the game thread
+	void BeginWidgets();
+	void EndWidgets();
+}
+
+/// Times a stage of the pipeline for "stat ImGui" and as a CPU scope of the ImGui channel
+#define IMGUI_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(STAT_ImGui_##Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("ImGui::" #Stat, ImGuiChannel)
+
+/// Adds to a per-frame counter of "stat ImGui" and of the ImGui channel
+#define IMGUI_INC_COUNTER(Counter, Amount) \
+	do \
+	{ \
+		INC_DWORD_STAT_BY(STAT_ImGui_##Counter, Amount); \
+		ImGuiStats::AddFrameCounter(EImGuiCounter::Counter, Amount); \
+	} while (0)
+
+/// Moves a memory stat of "stat ImGui" from the previous bytes of a context to its current ones, and adds them to the
+/// counter of the ImGui channel
+#define IMGUI_UPDATE_MEMORY(Counter, PrevBytes, Bytes) \
+	do \
+	{ \
+		DEC_MEMORY_STAT_BY(STAT_ImGui_##Counter, PrevBytes); \
+		INC_MEMORY_STAT_BY(STAT_ImGui_##Counter, Bytes); \
+		ImGuiStats::AddFrameCounter(EImGuiCounter::Counter, Bytes); \
+	} while (0)
@@ -1,8 +1,31 @@
 ﻿#include "SImGuiOverlay.h"
 
 #include <Framework/Application/SlateApplication.h>
+#include <Hash/CityHash.h>
+
+#if WITH_ENGINE
+#include <Engine/Texture2D.h>
+#endif
 
 #include "ImGuiContext.h"
+#include "ImGuiStats.h"
+
+static uint64 ImGui_HashDrawList(const FImGuiDrawList& DrawList)
+{
+	uint64 Hash = CityHash64(reinterpret_cast<const char*>(DrawList.VtxBuffer.Data), DrawList.VtxBuffer.size_in_bytes());
+	Hash = CityHash64WithSeed(reinterpret_cast<const char*>(DrawList.IdxBuffer.Data), DrawList.IdxBuffer.size_in_bytes(), Hash);
+
+	// Commands are hashed field by field as they contain padding
+	for (const ImDrawCmd& DrawCmd : DrawList.CmdBuffer)
+	{
+		const float ClipRect[] = { DrawCmd.ClipRect.x, DrawCmd.ClipRect.y, DrawCmd.ClipRect.z, DrawCmd.ClipRect.w };
+		const uint64 Fields[] = { reinterpret_cast<UPTRINT>(DrawCmd.GetTexID()), DrawCmd.VtxOffset, DrawCmd.IdxOffset, DrawCmd.ElemCount };
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(ClipRect), sizeof(ClipRect), Hash);
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(Fields), sizeof(Fields), Hash);
+	}
+
+	return Hash;
+}
 
 FImGuiDrawList::FImGuiDrawList(ImDrawList* Source)
 {
@@ -10,6 +33,8 @@ FImGuiDrawList::FImGuiDrawList(ImDrawList* Source)
 	IdxBuffer.swap(Source->IdxBuffer);
 	CmdBuffer.swap(Source->CmdBuffer);
 	Flags = Source->Flags;
+
+	Hash = ImGui_HashDrawList(*this);
 }
 
 FImGuiDrawData::FImGuiDrawData(const ImDrawData* Source)
@@ -25,6 +50,13 @@ FImGuiDrawData::FImGuiDrawData(const ImDrawData* Source)
 	DisplayPos = Source->DisplayPos;
 	DisplaySize = Source->DisplaySize;
 	FrameBufferScale = Source->FramebufferScale;
+
+	const float Display[] = { DisplayPos.X, DisplayPos.Y, DisplaySize.X, DisplaySize.Y };
+	Hash = CityHash64(reinterpret_cast<const char*>(Display), sizeof(Display));
+	for (const FImGuiDrawList& DrawList : DrawLists)
+	{
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&DrawList.Hash), sizeof(uint64), Hash);
+	}
 }
 
 class FImGuiInputProcessor : public IInputProcessor
@@ -261,6 +293,41 @@ SImGuiOverlay::~SImGuiOverlay()
 	}
 }
 
+/// Converts ImGui colors to the packed FColor layout, a byte swap unless ImGui is configured with BGRA colors
+static FORCEINLINE uint32 ImGui_ConvertPackedColor(uint32 Color)
+{
+	if constexpr (IM_COL32_R_SHIFT == 16 && IM_COL32_B_SHIFT == 0)
+	{
+		return Color;
+	}
+	else
+	{
+		return (Color & 0xFF00FF00) | ((Color >> 16) & 0xFF) | ((Color & 0xFF) << 16);
+	}
+}
+
+/// Equivalent to FSlateVertex::Make for the translation overlays are drawn with, without applying a full render transform
+/// to every vertex or unpacking colors byte by byte
+static void ImGui_ConvertVertices(FSlateVertex* RESTRICT Vertices, const ImDrawVert* RESTRICT Source, int32 Count, const FVector2f Translation)
+{
+	for (int32 VertexIdx = 0; VertexIdx < Count; ++VertexIdx)
+	{
+		const ImDrawVert& Vtx = Source[VertexIdx];
+		FSlateVertex& Vertex = Vertices[VertexIdx];
+
+		Vertex.TexCoords[0] = Vtx.uv.x;
+		Vertex.TexCoords[1] = Vtx.uv.y;
+		Vertex.TexCoords[2] = 1.0f;
+		Vertex.TexCoords[3] = 1.0f;
+		Vertex.MaterialTexCoords = FVector2f(Vtx.uv.x, Vtx.uv.y);
+		Vertex.Position = FVector2f(Vtx.pos.x + Translation.X, Vtx.pos.y + Translation.Y);
+		Vertex.Color = FColor(ImGui_ConvertPackedColor(Vtx.col));
+		Vertex.SecondaryColor = FColor(0);
+		Vertex.PixelSize[0] = 0;
+		Vertex.PixelSize[1] = 0;
+	}
+}
+
 int32 SImGuiOverlay::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
 {
 	if (!DrawData.bValid)
@@ -268,25 +335,51 @@ int32 SImGuiOverlay::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGe
 		return LayerId;
 	}
 
+	IMGUI_SCOPE_CYCLE_COUNTER(Paint);
+
 	const FSlateRenderTransform Transform(AllottedGeometry.GetAccumulatedRenderTransform().GetTranslation() - FVector2d(DrawData.DisplayPos));
+	const FVector2f Translation = Transform.GetTranslation();
 
-	FSlateBrush TextureBrush;
-	for (const FImGuiDrawList& DrawList : DrawData.DrawLists)
+	// Draw lists are only converted when they changed or the overlay moved
+	if (PaintGeneration != DrawDataGeneration || PaintTranslation != Translation)
 	{
-		TArray<FSlateVertex> Vertices;
-		Vertices.SetNumUninitialized(DrawList.VtxBuffer.Size);
-		for (int32 BufferIdx = 0; BufferIdx < Vertices.Num(); ++BufferIdx)
-		{
-			const ImDrawVert& Vtx = DrawList.VtxBuffer.Data[BufferIdx];
-			Vertices[BufferIdx] = FSlateVertex::Make<ESlateVertexRounding::Disabled>(Transform, Vtx.pos, Vtx.uv, FVector2f::UnitVector, ImGui::ConvertColor(Vtx.col));
-		}
+		PaintGeneration = DrawDataGeneration;
+		PaintTranslation = Translation;
 
-		TArray<SlateIndex> Indices;
-		Indices.SetNumUninitialized(DrawList.IdxBuffer.Size);
-		for (int32 BufferIdx = 0; BufferIdx < Indices.Num(); ++BufferIdx)
+		PaintVertices.SetNum(DrawData.DrawLists.Num());
+		PaintIndices.SetNum(DrawData.DrawLists.Num());
+
+		for (int32 ListIdx = 0; ListIdx < DrawData.DrawLists.Num(); ++ListIdx)
 		{
-			Indices[BufferIdx] = DrawList.IdxBuffer.Data[BufferIdx];
+			const FImGuiDrawList& DrawList = DrawData.DrawLists[ListIdx];
+
+			TArray<FSlateVertex>& Vertices = PaintVertices[ListIdx];
+			Vertices.SetNumUninitialized(DrawList.VtxBuffer.Size);
+			ImGui_ConvertVertices(Vertices.GetData(), DrawList.VtxBuffer.Data, Vertices.Num(), Translation);
+
+			static_assert(sizeof(ImDrawIdx) <= sizeof(SlateIndex), "ImDrawIdx must fit in Slate indices");
+			TArray<SlateIndex>& Indices = PaintIndices[ListIdx];
+			Indices.SetNumUninitialized(DrawList.IdxBuffer.Size);
+			if constexpr (sizeof(ImDrawIdx) == sizeof(SlateIndex))
+			{
+				FMemory::Memcpy(Indices.GetData(), DrawList.IdxBuffer.Data, DrawList.IdxBuffer.size_in_bytes());
+			}
+			else
+			{
+				for (int32 BufferIdx = 0; BufferIdx < Indices.Num(); ++BufferIdx)
+				{
+					Indices[BufferIdx] = DrawList.IdxBuffer.Data[BufferIdx];
+				}
+			}
 		}
+	}
+
+	FSlateBrush TextureBrush;
+	for (int32 ListIdx = 0; ListIdx < DrawData.DrawLists.Num(); ++ListIdx)
+	{
+		const FImGuiDrawList& DrawList = DrawData.DrawLists[ListIdx];
+		const TArray<FSlateVertex>& Vertices = PaintVertices[ListIdx];
+		const TArray<SlateIndex>& Indices = PaintIndices[ListIdx];
 
 		for (const ImDrawCmd& DrawCmd : DrawList.CmdBuffer)
 		{
@@ -335,6 +428,8 @@ int32 SImGuiOverlay::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGe
 			FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, TextureBrush.GetRenderingResource(), VerticesSlice, IndicesSlice, nullptr, 0, 0);
 			OutDrawElements.PopClip();
 		}
+
+		IMGUI_INC_COUNTER(SlateElements, DrawList.CmdBuffer.Size);
 	}
 
 	return LayerId;
@@ -368,5 +463,19 @@ TSharedPtr<FImGuiContext> SImGuiOverlay::GetContext() const
 
 void SImGuiOverlay::SetDrawData(const ImDrawData* InDrawData)
 {
-	DrawData = FImGuiDrawData(InDrawData);
+	SetDrawData(FImGuiDrawData(InDrawData));
+}
+
+void SImGuiOverlay::SetDrawData(FImGuiDrawData&& InDrawData)
+{
+	if (InDrawData.bValid == DrawData.bValid && InDrawData.Hash == DrawData.Hash)
+	{
+		// Keeps the converted buffers, and the cached paint when under an invalidation panel
+		return;
+	}
+
+	DrawData = MoveTemp(InDrawData);
+	++DrawDataGeneration;
+
+	Invalidate(EInvalidateWidgetReason::Paint);
 }
@@ -14,6 +14,9 @@ struct FImGuiDrawList
 	ImVector<ImDrawIdx> IdxBuffer;
 	ImVector<ImDrawCmd> CmdBuffer;
 	ImDrawListFlags Flags = ImDrawListFlags_None;
+
+	/// Hash of the buffers, equal for draw lists which draw the same
+	uint64 Hash = 0;
 };
 
 struct FImGuiDrawData
@@ -31,6 +34,9 @@ struct FImGuiDrawData
 	FVector2f DisplayPos = FVector2f::ZeroVector;
 	FVector2f DisplaySize = FVector2f::ZeroVector;
 	FVector2f FrameBufferScale = FVector2f::ZeroVector;
+
+	/// Hash of the draw lists and display, equal for frames which draw the same
+	uint64 Hash = 0;
 };
 
 class SImGuiOverlay : public SLeafWidget
@@ -53,9 +59,19 @@ public:
 
 	TSharedPtr<FImGuiContext> GetContext() const;
 	void SetDrawData(const ImDrawData* InDrawData);
+	void SetDrawData(FImGuiDrawData&& InDrawData);
 
 private:
 	TSharedPtr<FImGuiContext> Context = nullptr;
 	TSharedPtr<IInputProcessor> InputProcessor = nullptr;
 	FImGuiDrawData DrawData;
+
+	/// Incremented whenever the draw data changes, unchanged frames keep the previous draw data and its converted buffers
+	uint32 DrawDataGeneration = 1;
+
+	/// Slate buffers converted from the draw lists by the last paint
+	mutable TArray<TArray<FSlateVertex>> PaintVertices;
+	mutable TArray<TArray<SlateIndex>> PaintIndices;
+	mutable uint32 PaintGeneration = 0;
+	mutable FVector2f PaintTranslation = FVector2f::ZeroVector;
 };
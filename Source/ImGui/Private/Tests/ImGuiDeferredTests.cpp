@@ -0,0 +1,48 @@
+#include <Misc/AutomationTest.h>
+
+#include "ImGuiContext.h"
+#include "ImGuiDeferred.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FImGuiDeferredTrimTest, "ImGui.Deferred.Trim",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FImGuiDeferredTrimTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 BatchCount = 8;
+
+	// Frames aren't stepped by the test, so nothing replays what is recorded for the context
+	TSharedPtr<FImGuiContext> Context = FImGuiContext::Create();
+
+	const auto Record = [&Context]()
+	{
+		for (int32 BatchIdx = 0; BatchIdx < BatchCount; ++BatchIdx)
+		{
+			FImGuiDeferredScope Deferred(Context, "Deferred Test");
+			Deferred.Text("Batch %d", BatchIdx);
+			Deferred.AddRectFilled(ImVec2(0.0f, 0.0f), ImVec2(16.0f, 16.0f), IM_COL32_WHITE);
+		}
+	};
+
+	// Batches recorded before the test by other contexts
+	FImGuiDeferredScope::Trim(MAX_uint64);
+
+	Record();
+	TestEqual(TEXT("Batches recorded without a replay"), FImGuiDeferredScope::GetPendingBatchCount(), BatchCount);
+
+	FImGuiDeferredScope::Trim(GFrameCounter + 16);
+	TestEqual(TEXT("Batches kept for 16 frames"), FImGuiDeferredScope::GetPendingBatchCount(), BatchCount);
+
+	FImGuiDeferredScope::Trim(GFrameCounter + 17);
+	TestEqual(TEXT("Batches dropped after 16 frames"), FImGuiDeferredScope::GetPendingBatchCount(), 0);
+
+	Record();
+	Context.Reset();
+	FImGuiDeferredScope::Trim(GFrameCounter);
+	TestEqual(TEXT("Batches dropped with their context"), FImGuiDeferredScope::GetPendingBatchCount(), 0);
+
+	return true;
+}
+
+#endif
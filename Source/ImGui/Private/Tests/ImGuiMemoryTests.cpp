@@ -0,0 +1,111 @@
+#include <Misc/AutomationTest.h>
+
+#if WITH_ENGINE
+THIRD_PARTY_INCLUDES_START
+#include <imgui.h>
+#include <implot.h>
+THIRD_PARTY_INCLUDES_END
+
+#include "ImGuiContext.h"
+#include "ImGuiRenderTarget.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FImGuiMemoryBudgetTest, "ImGui.Memory.Budget",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FImGuiMemoryBudgetTest::RunTest(const FString& Parameters)
+{
+	static constexpr int32 WindowCount = 16;
+	static constexpr int32 PointCount = 1000;
+
+	// A render target gives the context a display to draw in without a Slate window
+	const TSharedRef<FImGuiRenderTarget> RenderTarget = FImGuiRenderTarget::Create(FIntPoint(1024, 768));
+	const TSharedPtr<FImGuiContext> Context = RenderTarget->GetContext();
+
+	TArray<float> Values;
+	for (int32 PointIdx = 0; PointIdx < PointCount; ++PointIdx)
+	{
+		Values.Add(FMath::Sin(PointIdx * 0.01f));
+	}
+
+	bool bShowWindows = true;
+	Context->OnDraw.AddLambda([&bShowWindows, &Values]()
+	{
+		if (!bShowWindows)
+		{
+			return;
+		}
+
+		for (int32 WindowIdx = 0; WindowIdx < WindowCount; ++WindowIdx)
+		{
+			ImGui::SetNextWindowPos(ImVec2(WindowIdx * 16.0f, WindowIdx * 16.0f));
+			ImGui::SetNextWindowSize(ImVec2(512.0f, 512.0f));
+			if (ImGui::Begin(TCHAR_TO_ANSI(*FString::Printf(TEXT("Window %d"), WindowIdx))))
+			{
+				for (int32 LineIdx = 0; LineIdx < 64; ++LineIdx)
+				{
+					ImGui::Text("Window %d, line %d", WindowIdx, LineIdx);
+				}
+
+				if (ImGui::BeginTable("Table", 4))
+				{
+					for (int32 CellIdx = 0; CellIdx < 64; ++CellIdx)
+					{
+						ImGui::TableNextColumn();
+						ImGui::Text("Cell %d", CellIdx);
+					}
+					ImGui::EndTable();
+				}
+
+				if (ImPlot::BeginPlot("Plot"))
+				{
+					ImPlot::PlotLine("Values", Values.GetData(), Values.Num());
+					ImPlot::EndPlot();
+				}
+			}
+			ImGui::End();
+		}
+	});
+
+	// Frames are stepped here rather than by the engine, the context's own hooks find it outside of a frame
+	const auto StepFrame = [&Context]()
+	{
+		Context->BeginFrame();
+		Context->EndFrame();
+	};
+
+	// Measured every frame, without compacting
+	Context->SetMemoryBudget(MAX_int64);
+	for (int32 FrameIdx = 0; FrameIdx < 3; ++FrameIdx)
+	{
+		StepFrame();
+	}
+
+	// The windows are hidden, but hold on to their buffers until compacted
+	bShowWindows = false;
+	StepFrame();
+	const FImGuiMemoryStats ShownStats = Context->GetMemoryStats();
+	TestTrue(TEXT("Memory held by the windows"), ShownStats.DrawLists > 0 && ShownStats.Tables > 0 && ShownStats.PlotItems > 0);
+
+	const int32 CompactionCount = Context->GetMemoryCompactionCount();
+	Context->SetMemoryBudget(ShownStats.Total / 2);
+	StepFrame();
+	TestEqual(TEXT("Compactions once over budget"), Context->GetMemoryCompactionCount(), CompactionCount + 1);
+
+	StepFrame();
+	const FImGuiMemoryStats& CompactedStats = Context->GetMemoryStats();
+	TestTrue(TEXT("Total memory after a compaction"), CompactedStats.Total < ShownStats.Total);
+	TestTrue(TEXT("Draw list memory after a compaction"), CompactedStats.DrawLists < ShownStats.DrawLists);
+	TestTrue(TEXT("Plot item memory after a compaction"), CompactedStats.PlotItems < ShownStats.PlotItems);
+	TestTrue(TEXT("Peak memory after a compaction"), Context->GetPeakMemoryStats().Total >= ShownStats.Total);
+
+	StepFrame();
+	TestEqual(TEXT("Compactions while below the compacted memory"), Context->GetMemoryCompactionCount(), CompactionCount + 1);
+
+	Context->OnDraw.Clear();
+	return true;
+}
+
+#endif
+#endif
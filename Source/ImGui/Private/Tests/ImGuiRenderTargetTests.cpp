@@ -0,0 +1,84 @@
+#include <Misc/AutomationTest.h>
+
+#if WITH_ENGINE
+THIRD_PARTY_INCLUDES_START
+#include <imgui.h>
+THIRD_PARTY_INCLUDES_END
+
+#include "ImGuiContext.h"
+#include "ImGuiRenderTarget.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FImGuiRenderTargetUpdateTest, "ImGui.RenderTarget.Update",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FImGuiRenderTargetUpdateTest::RunTest(const FString& Parameters)
+{
+	const TSharedRef<FImGuiRenderTarget> RenderTarget = FImGuiRenderTarget::Create(FIntPoint(256, 128));
+	const TSharedPtr<FImGuiContext> Context = RenderTarget->GetContext();
+
+	int32 Value = 0;
+	Context->OnDraw.AddLambda([&Value]()
+	{
+		// Placed and sized up front so the window doesn't change while it settles
+		ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+		ImGui::SetNextWindowSize(ImVec2(256.0f, 128.0f));
+		if (ImGui::Begin("Panel", nullptr, ImGuiWindowFlags_NoDecoration))
+		{
+			ImGui::Text("Value: %d", Value);
+		}
+		ImGui::End();
+	});
+
+	// Frames are stepped here rather than by the engine, the context's own hooks find it outside of a frame
+	const auto StepFrame = [&Context]()
+	{
+		Context->BeginFrame();
+		Context->EndFrame();
+	};
+
+	const auto TestGeometry = [this, &Context, &RenderTarget]()
+	{
+		ImGui::FScopedContext ScopedContext(Context);
+		const ImDrawData* DrawData = ImGui::GetDrawData();
+		if (TestNotNull(TEXT("Draw data of the context"), DrawData))
+		{
+			TestEqual(TEXT("Vertices of the last update"), RenderTarget->GetVertexCount(), DrawData->TotalVtxCount);
+			TestEqual(TEXT("Indices of the last update"), RenderTarget->GetIndexCount(), DrawData->TotalIdxCount);
+		}
+	};
+
+	const auto TestUnchangedFrames = [this, &StepFrame, &RenderTarget]()
+	{
+		const int32 UpdateCount = RenderTarget->GetUpdateCount();
+		for (int32 FrameIdx = 0; FrameIdx < 4; ++FrameIdx)
+		{
+			StepFrame();
+			TestEqual(TEXT("Updates after an unchanged frame"), RenderTarget->GetUpdateCount(), UpdateCount);
+			TestTrue(TEXT("Dirty rect of an unchanged frame is empty"), RenderTarget->GetDirtyRect().IsEmpty());
+		}
+	};
+
+	StepFrame();
+	StepFrame();
+	TestTrue(TEXT("The first frames update the target"), RenderTarget->GetUpdateCount() > 0);
+	TestGeometry();
+
+	TestUnchangedFrames();
+
+	const int32 UpdateCount = RenderTarget->GetUpdateCount();
+	Value = 12345;
+	StepFrame();
+	TestEqual(TEXT("Updates after a changed frame"), RenderTarget->GetUpdateCount(), UpdateCount + 1);
+	TestFalse(TEXT("Dirty rect of a changed frame is empty"), RenderTarget->GetDirtyRect().IsEmpty());
+	TestGeometry();
+
+	TestUnchangedFrames();
+
+	Context->OnDraw.Clear();
+	return true;
+}
+
+#endif
+#endif
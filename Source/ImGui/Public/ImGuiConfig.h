@@ -45,6 +45,16 @@ uint64 ImFileWrite(const void* Data, uint64 Size, uint64 Count, ImFileHandle Fil
 #define ImTextureID struct FSlateBrush*
 #endif
 
+/// Slate indices are 32-bit, so large plots are drawn with fewer draw commands than when ImGui splits them every 64K vertices;
+/// define IMGUI_USE_32BIT_INDICES=0 to use ImGui's default 16-bit indices instead
+#ifndef IMGUI_USE_32BIT_INDICES
+#define IMGUI_USE_32BIT_INDICES 1
+#endif
+
+#if IMGUI_USE_32BIT_INDICES
+#define ImDrawIdx uint32
+#endif
+
 class FImGuiContext;
 struct ImGuiContext;
 struct ImPlotContext;
@@ -62,6 +72,9 @@ namespace ImGui
 	///		ImGui::ShowDemoWindow();
 	///	}
 	/// @endcode
+	/// Session contexts are cached on the game thread so the default constructor doesn't look them up or copy shared pointers,
+	/// and scopes of the context which is already current don't switch contexts. See FImGuiContext::OnDraw to draw many
+	/// widgets under a single scope per frame.
 	struct IMGUI_API FScopedContext
 	{
 		UE_NODISCARD_CTOR explicit FScopedContext(const int32 PIEInstance = GPlayInEditorID);
@@ -78,9 +91,17 @@ namespace ImGui
 		FImGuiContext* operator->() const;
 
 	private:
-		TSharedPtr<FImGuiContext> Context = nullptr;
+		void Activate();
+
+		FImGuiContext* Context = nullptr;
+
+		/// Keeps contexts passed by shared pointer alive, session contexts are owned by the module
+		TSharedPtr<FImGuiContext> ContextRef = nullptr;
+
 		ImGuiContext* PrevContext = nullptr;
 		ImPlotContext* PrevPlotContext = nullptr;
+		bool bRestoresContext = false;
+		bool bTimesWidgets = false;
 	};
 
 	/// Converts between Unreal and ImGui key types
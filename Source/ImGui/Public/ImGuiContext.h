@@ -1,16 +1,13 @@
 #pragma once
 
+#include <Delegates/Delegate.h>
 #include <Templates/SharedPointer.h>
 
-#if WITH_ENGINE
-#include <Engine/Texture2D.h>
-#include <UObject/StrongObjectPtr.h>
-#endif
-
+class FImGuiFontAtlas;
+class FImGuiRenderTarget;
 class SWindow;
 class SImGuiOverlay;
 struct FDisplayMetrics;
-struct FSlateBrush;
 struct ImGuiContext;
 struct ImGuiViewport;
 struct ImPlotContext;
@@ -20,15 +17,49 @@ struct IMGUI_API FImGuiViewportData
 	/// Returns the existing viewport data or creates one
 	static FImGuiViewportData* GetOrCreate(ImGuiViewport* Viewport);
 
+	/// Caches the state of the window and overlay, read by ImGui's platform callbacks instead of querying Slate on every call
+	void Refresh();
+
 	TWeakPtr<SWindow> Window = nullptr;
 	TWeakPtr<SImGuiOverlay> Overlay = nullptr;
+	TWeakPtr<FImGuiRenderTarget> RenderTarget = nullptr;
+
+	/// Refreshed at the start of every frame, and when ImGui moves, resizes, or focuses the window
+	FVector2f Pos = FVector2f::ZeroVector;
+	FVector2f Size = FVector2f::ZeroVector;
+	bool bFocused = false;
+	bool bMinimized = false;
+	bool bHidden = false;
+};
+
+/// Bytes held by a context, estimated from the capacity of the buffers of its ImGui and ImPlot state. The font atlas is
+/// shared by contexts, and counted once by the module in the font memory of "stat ImGui" instead.
+struct FImGuiMemoryStats
+{
+	/// Draw lists of windows and viewports
+	int64 DrawLists = 0;
+
+	/// Tables, their columns and temporary data
+	int64 Tables = 0;
+
+	/// Windows, their ImGuiStorage and ID stacks, and settings
+	int64 Storage = 0;
+
+	/// Input text, clipboard, log and ini buffers
+	int64 TextBuffers = 0;
+
+	/// Plots and subplots with their items, legends and ticks, and ImPlot's caches
+	int64 PlotItems = 0;
+
+	int64 Total = 0;
 };
 
 class IMGUI_API FImGuiContext : public TSharedFromThis<FImGuiContext>
 {
 public:
-	/// Creates a managed ImGui context
-	static TSharedRef<FImGuiContext> Create();
+	/// Creates a managed ImGui context, networking and the font atlas texture aren't set up until first needed
+	/// @param FontAtlasContext Optional context whose font atlas is shared, otherwise the atlas shared by all contexts
+	static TSharedRef<FImGuiContext> Create(const TSharedPtr<FImGuiContext>& FontAtlasContext = nullptr);
 
 	/// Returns an existing managed ImGui context
 	static TSharedPtr<FImGuiContext> Get(const ImGuiContext* Context);
@@ -50,15 +81,40 @@ public:
 	/// Closes all remote connections
 	void Disconnect();
 
+	/// Sets how many bytes the context may hold before the buffers of windows, tables and plots which weren't shown in the
+	/// last frame are freed, 0 disables the budget. ImGui's own IO.ConfigMemoryCompactTimer still applies.
+	void SetMemoryBudget(int64 Bytes);
+	int64 GetMemoryBudget() const;
+
+	/// Returns the bytes held by the context at the start of the last frame, only measured while a budget is set or while
+	/// "stat ImGui" or the ImGui trace channel are enabled
+	const FImGuiMemoryStats& GetMemoryStats() const;
+
+	/// Returns the most bytes held by each category, and in total, since the context was created
+	const FImGuiMemoryStats& GetPeakMemoryStats() const;
+
+	/// Returns how many times the context was compacted to stay within its budget
+	int32 GetMemoryCompactionCount() const;
+
 	/// Access to the underlying ImGui context
 	operator ImGuiContext*() const;
 
 	/// Access to the underlying ImPlot context
 	operator ImPlotContext*() const;
 
+	/// Broadcast by EndFrame with this context current, so many widgets can draw under one context switch per frame
+	/// instead of each opening an ImGui::FScopedContext
+	FSimpleMulticastDelegate OnDraw;
+
 private:
 	void Initialize();
 
+	/// Uploads the font atlas if needed, and copies its marker sprites when it was uploaded again
+	void UpdateFontAtlas();
+
+	/// Measures the memory held by the context, and compacts it when over budget
+	void UpdateMemory();
+
 	void OnDisplayMetricsChanged(const FDisplayMetrics& DisplayMetrics);
 
 	ImGuiContext* Context = nullptr;
@@ -68,9 +124,19 @@ private:
 	char LogFilenameAnsi[1024] = {};
 	bool bIsRemote = false;
 
-#if WITH_ENGINE
-	TStrongObjectPtr<UTexture2D> FontAtlasTexturePtr = nullptr;
-#else
-	TSharedPtr<FSlateBrush> FontAtlasTexturePtr = nullptr;
-#endif
+	/// NetImgui is started by the first Listen or Connect rather than by every context
+	bool bNetImguiStarted = false;
+
+	TSharedPtr<FImGuiFontAtlas> FontAtlas = nullptr;
+	uint32 FontAtlasGeneration = 0;
+
+	FImGuiMemoryStats MemoryStats;
+	FImGuiMemoryStats PeakMemoryStats;
+	int64 MemoryBudget = 0;
+
+	/// Bytes held after the last compaction, the context is only compacted again once it grew past them so that a budget
+	/// lower than what the shown windows need doesn't compact every frame
+	int64 MemoryCompactedTotal = 0;
+	int32 MemoryCompactionCount = 0;
+	bool bMemoryCompacted = false;
 };
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Templates/SharedPointer.h>
+
+THIRD_PARTY_INCLUDES_START
+#include <imgui.h>
+THIRD_PARTY_INCLUDES_END
+
+class FImGuiContext;
+struct FImGuiDeferredChunk;
+struct FImGuiDeferredRecorder;
+
+/// Records ImGui commands on any thread, replayed into a context on the game thread by FImGuiContext::EndFrame before ImGui::Render
+///
+/// Commands are appended to a buffer owned by the recording thread without locks or atomics, the outermost scope hands them
+/// over to the game thread with a single atomic operation when it ends. Text is formatted, truncated to 1023 characters, and
+/// strings and values are copied when recorded. Commands outside of a window go to ImGui's implicit debug window, and
+/// primitives outside of a window to the foreground draw list in screen space. Commands not replayed within 16 frames of
+/// being recorded are dropped at the end of a frame, e.g. when the context is remote and not connected.
+///
+///		AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [Context = FImGuiModule::Get().FindOrCreateSessionContext(), this]
+///		{
+///			FImGuiDeferredScope Deferred(Context, "Navigation");
+///			Deferred.Text("Paths: %d", Paths.Num());
+///			Deferred.PlotLine("Timings", "Pathfinding (ms)", PathTimings.GetData(), PathTimings.Num());
+///		});
+class IMGUI_API FImGuiDeferredScope
+{
+public:
+	/// Begins recording commands for a context, into a window when a name is given; scopes can be nested on the same thread
+	UE_NODISCARD_CTOR explicit FImGuiDeferredScope(const TSharedPtr<FImGuiContext>& Context, const char* WindowName = nullptr);
+	~FImGuiDeferredScope();
+
+	FImGuiDeferredScope(const FImGuiDeferredScope&) = delete;
+	FImGuiDeferredScope& operator=(const FImGuiDeferredScope&) = delete;
+
+	void Text(const char* Fmt, ...) IM_FMTARGS(2);
+	void TextColored(uint32 Color, const char* Fmt, ...) IM_FMTARGS(3);
+	void Separator();
+
+	/// Plots values against their index, consecutive series of the same plot are drawn in one ImPlot::BeginPlot
+	void PlotLine(const char* PlotName, const char* SeriesName, const float* Values, int32 Count);
+
+	/// Draw list primitives, positions are relative to the cursor in a window and in screen space outside of one
+	void AddLine(const ImVec2& P1, const ImVec2& P2, uint32 Color, float Thickness = 1.0f);
+	void AddRect(const ImVec2& Min, const ImVec2& Max, uint32 Color, float Thickness = 1.0f);
+	void AddRectFilled(const ImVec2& Min, const ImVec2& Max, uint32 Color);
+	void AddCircle(const ImVec2& Center, float Radius, uint32 Color, float Thickness = 1.0f);
+	void AddCircleFilled(const ImVec2& Center, float Radius, uint32 Color);
+	void AddText(const ImVec2& Pos, uint32 Color, const char* Text);
+
+	/// Drops the commands of released contexts and those recorded more than 16 frames before the given one, called by the
+	/// module at the end of every frame whether or not a context is within one
+	static void Trim(uint64 Frame);
+
+	/// Returns the number of recorded batches not yet replayed nor dropped, on the game thread
+	static int32 GetPendingBatchCount();
+
+private:
+	friend class FImGuiContext;
+
+	/// Replays the commands recorded for a context, called by FImGuiContext::EndFrame on the game thread
+	static void Replay(const FImGuiContext& Context);
+
+	FImGuiDeferredRecorder& Recorder;
+	bool bWindow = false;
+};
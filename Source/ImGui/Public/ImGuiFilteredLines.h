@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Containers/StringView.h>
+#include <Templates/Function.h>
+#include <Templates/SharedPointer.h>
+
+struct ImGuiTextFilter;
+
+/// Filters a large append-only list of lines (e.g. a log console) with an ImGuiTextFilter for display through ImGuiListClipper
+///
+/// Results are cached between frames: appended lines are filtered incrementally and a query that narrows the previous one
+/// (extending a term, adding an exclusion) only rescans the previous matches. Passes over many lines run on a worker thread,
+/// the matches found so far are published every frame so the list fills in while the user keeps typing.
+///
+///		Lines.Update(Filter, Log.Num());
+///		ImGuiListClipper Clipper;
+///		Clipper.Begin(Lines.Num());
+///		while (Clipper.Step())
+///			for (int32 MatchIdx = Clipper.DisplayStart; MatchIdx < Clipper.DisplayEnd; ++MatchIdx)
+///				ImGui::TextUnformatted(*Log[Lines[MatchIdx]]);
+class IMGUI_API FImGuiFilteredLines
+{
+public:
+	/// Returns the text of a line, called from worker threads, lines must not change once they have been passed to Update
+	using FGetLine = TFunction<FAnsiStringView(int32 LineIndex)>;
+
+	explicit FImGuiFilteredLines(FGetLine InGetLine);
+	~FImGuiFilteredLines();
+
+	/// Picks up new matches and restarts filtering when the query or the line count changed, call once per frame before drawing
+	void Update(const ImGuiTextFilter& Filter, int32 LineCount);
+
+	/// Forgets all matches, required when lines were removed or modified
+	void Reset();
+
+	/// Number of lines matched so far
+	int32 Num() const { return Matches.Num(); }
+
+	/// Returns the line index of a match, in ascending line order
+	int32 operator[](int32 MatchIndex) const { return Matches[MatchIndex]; }
+
+	/// Whether a pass is still running and more matches may be added
+	bool IsFiltering() const;
+
+	/// Passes scanning fewer lines than this run synchronously in Update
+	int32 AsyncLineThreshold = 32 * 1024;
+
+private:
+	struct FPass;
+
+	void StartPass(const TSharedRef<FPass>& NewPass);
+	void CancelPass();
+	void CollectMatches();
+
+	FGetLine GetLine;
+	TSharedPtr<FPass> Pass;
+	TArray<int32> Matches;
+};
@@ -20,6 +20,9 @@ public:
 	/// @param PIEInstance Optional target Play-in-Editor instance, defaults to the current instance
 	TSharedPtr<FImGuiContext> FindOrCreateSessionContext(const int32 PIEInstance = GPlayInEditorID);
 
+	/// Returns a counter incremented whenever session contexts are released, invalidating raw pointers to them
+	uint32 GetSessionGeneration() const;
+
 	/// Creates an ImGui context for a Slate window
 	static TSharedPtr<FImGuiContext> CreateWindowContext(const TSharedRef<SWindow>& Window);
 
@@ -30,4 +33,8 @@ private:
 	void OnEndPIE(bool bIsSimulating);
 
 	TMap<int32, TSharedPtr<FImGuiContext>> SessionContexts;
+	uint32 SessionGeneration = 1;
+	FDelegateHandle FlushFrameCountersHandle;
+	FDelegateHandle UpdateFontMemoryHandle;
+	FDelegateHandle TrimDeferredHandle;
 };
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Containers/Array.h>
+#include <Templates/SharedPointer.h>
+
+#if WITH_ENGINE
+#include <Engine/Texture2D.h>
+#include <UObject/StrongObjectPtr.h>
+#endif
+
+THIRD_PARTY_INCLUDES_START
+#include <implot.h>
+THIRD_PARTY_INCLUDES_END
+
+struct FSlateBrush;
+
+/// Plots a large heatmap as a single textured quad instead of ImPlot::PlotHeatmap's quad per cell
+///
+/// The values are colormapped into a texture on worker threads, which is only updated when the values, the scale, the
+/// colormap or the layout change. Labels are only formatted for the visible cells large enough on screen to show them.
+/// Like ImPlot::PlotImage, the texture is stretched linearly between the bounds so the axes should not be log scaled.
+///
+///		if (ImPlot::BeginPlot("Density"))
+///		{
+///			DensityHeatmap.Plot("##Density", Density.GetData(), 1024, 1024, 0.0, 0.0, nullptr);
+///			ImPlot::EndPlot();
+///		}
+class IMGUI_API FImGuiPlotHeatmap
+{
+public:
+	/// Same parameters as ImPlot::PlotHeatmap, call between ImPlot::BeginPlot and ImPlot::EndPlot
+	void Plot(const char* LabelId, const float* Values, int32 Rows, int32 Cols, double ScaleMin = 0, double ScaleMax = 0, const char* LabelFmt = "%.1f",
+		const ImPlotPoint& BoundsMin = ImPlotPoint(0, 0), const ImPlotPoint& BoundsMax = ImPlotPoint(1, 1), ImPlotHeatmapFlags Flags = 0);
+	void Plot(const char* LabelId, const double* Values, int32 Rows, int32 Cols, double ScaleMin = 0, double ScaleMax = 0, const char* LabelFmt = "%.1f",
+		const ImPlotPoint& BoundsMin = ImPlotPoint(0, 0), const ImPlotPoint& BoundsMax = ImPlotPoint(1, 1), ImPlotHeatmapFlags Flags = 0);
+
+	/// Forces the texture to be updated by the next Plot, only needed when the values are not hashed
+	void Invalidate() { bDirty = true; }
+
+	/// Whether Plot hashes the values to detect changes, disable for large heatmaps updated through Invalidate
+	bool bHashValues = true;
+
+	/// Heatmaps with fewer cells than this are colormapped on the calling thread
+	int32 ParallelCellThreshold = 64 * 1024;
+
+private:
+	template <typename T>
+	void PlotImpl(const char* LabelId, const T* Values, int32 Rows, int32 Cols, double ScaleMin, double ScaleMax, const char* LabelFmt,
+		const ImPlotPoint& BoundsMin, const ImPlotPoint& BoundsMax, ImPlotHeatmapFlags Flags);
+
+	template <typename T>
+	void UpdatePixels(const T* Values, int32 Rows, int32 Cols, double ScaleMin, double ScaleMax, bool bColMajor);
+
+	void UpdateTexture(int32 Width, int32 Height);
+
+	TArray<uint32> Pixels;
+
+	/// Inputs of the current texture
+	uint64 ValuesHash = 0;
+	const void* ValuesPtr = nullptr;
+	int32 CachedRows = 0;
+	int32 CachedCols = 0;
+	double CachedScaleMin = 0;
+	double CachedScaleMax = 0;
+	ImPlotColormap CachedColormap = -1;
+	bool bCachedColMajor = false;
+	bool bDirty = true;
+
+	/// Scale resolved from the values when both ScaleMin and ScaleMax are 0
+	double ResolvedScaleMin = 0;
+	double ResolvedScaleMax = 0;
+
+#if WITH_ENGINE
+	TStrongObjectPtr<UTexture2D> Texture = nullptr;
+#else
+	TSharedPtr<FSlateBrush> Texture = nullptr;
+#endif
+};
@@ -0,0 +1,72 @@
+#pragma once
+
+#if WITH_ENGINE
+#include <Math/Box2D.h>
+#include <Math/IntRect.h>
+#include <Templates/SharedPointer.h>
+#include <UObject/StrongObjectPtr.h>
+
+class FImGuiContext;
+class FWidgetRenderer;
+class SImGuiOverlay;
+class UTextureRenderTarget2D;
+struct ImDrawData;
+
+/// Presents an ImGui context into a render target instead of a Slate window, e.g. for debug panels attached to actors
+///
+/// The target is only drawn when the draw data of its context changes, and many small targets can share the font atlas of
+/// one context rather than each building and uploading their own. Contexts of render targets don't receive input.
+///
+///		PanelTarget = FImGuiRenderTarget::Create(FIntPoint(256, 128), FImGuiModule::Get().FindOrCreateSessionContext());
+///		PanelTarget->GetContext()->OnDraw.AddUObject(this, &AMyCharacter::DrawDebugPanel);
+///		PanelMaterial->SetTextureParameterValue(TEXT("Panel"), PanelTarget->GetRenderTarget());
+class IMGUI_API FImGuiRenderTarget : public TSharedFromThis<FImGuiRenderTarget>
+{
+public:
+	/// Creates a context presented into a new render target
+	/// @param Size Size of the render target and of the context's display in pixels
+	/// @param FontAtlasContext Optional context whose font atlas is shared with the new context
+	static TSharedRef<FImGuiRenderTarget> Create(const FIntPoint& Size, const TSharedPtr<FImGuiContext>& FontAtlasContext = nullptr);
+
+	TSharedPtr<FImGuiContext> GetContext() const;
+	UTextureRenderTarget2D* GetRenderTarget() const;
+	FIntPoint GetSize() const;
+
+	/// Returns how many times the target was drawn, frames with unchanged draw data don't draw it
+	int32 GetUpdateCount() const;
+
+	/// Returns the area of the target covered by the draw lists which changed in the last frame, empty if none did
+	FIntRect GetDirtyRect() const;
+
+	/// Returns the geometry submitted by the last update
+	int32 GetVertexCount() const;
+	int32 GetIndexCount() const;
+
+	/// Takes the draw data of the context's main viewport, drawing the target if it changed
+	void SetDrawData(const ImDrawData* InDrawData);
+
+private:
+	void Initialize(const FIntPoint& InSize, const TSharedPtr<FImGuiContext>& FontAtlasContext);
+
+	struct FDrawListState
+	{
+		uint64 Hash = 0;
+		FBox2f Bounds = FBox2f(ForceInit);
+	};
+
+	TSharedPtr<FImGuiContext> Context = nullptr;
+	TSharedPtr<SImGuiOverlay> Overlay = nullptr;
+	TSharedPtr<FWidgetRenderer> WidgetRenderer = nullptr;
+	TStrongObjectPtr<UTextureRenderTarget2D> RenderTargetPtr = nullptr;
+
+	FIntPoint Size = FIntPoint::ZeroValue;
+
+	/// Draw lists of the last drawn frame, compared against the next one to find what changed
+	TArray<FDrawListState> DrawLists;
+
+	FIntRect DirtyRect;
+	int32 UpdateCount = 0;
+	int32 VertexCount = 0;
+	int32 IndexCount = 0;
+};
+#endif
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <Containers/ArrayView.h>
+#include <Templates/Function.h>
+#include <Templates/SharedPointer.h>
+
+struct ImGuiTableColumnSortSpecs;
+
+/// Sorts the rows of a large table on worker threads for display through BeginTable and ImGuiListClipper
+///
+/// The row order is cached per sort specs, switching back to a previous sort is immediate and rows invalidated since then
+/// are merged back in place instead of sorting everything again. While a sort is running the previous order remains visible.
+///
+///		if (ImGui::BeginTable("Assets", 3, ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY))
+///		{
+///			ImGui::TableSetupColumn(...);
+///			ImGui::TableHeadersRow();
+///			SortedTable.Update(Assets.Num());
+///			SortedTable.DrawRows([&](int32 RowIndex) { ImGui::TableNextRow(); ... });
+///			ImGui::EndTable();
+///		}
+class IMGUI_API FImGuiSortedTable
+{
+public:
+	/// Compares two rows on a column in ascending order returning <0, 0 or >0, called concurrently from worker threads
+	using FCompareRows = TFunction<int32(const ImGuiTableColumnSortSpecs& Column, int32 RowA, int32 RowB)>;
+
+	explicit FImGuiSortedTable(FCompareRows InCompareRows);
+	~FImGuiSortedTable();
+
+	/// Picks up finished sorts and starts sorting when the current table's sort specs, the row count or invalidated rows
+	/// require it, call once per frame after the table columns have been set up
+	void Update(int32 RowCount);
+
+	/// Flags rows whose sort keys changed so they get moved into place, sort keys must not change while IsSorting() is true
+	void InvalidateRows(TConstArrayView<int32> Rows);
+
+	/// Forgets all cached orders, required when rows were removed or reordered; running sorts are cancelled without waiting
+	/// for them, so rows may only be removed once IsSorting() is false
+	void Reset();
+
+	/// Blocks until the running sort and the cancelled ones still returning, if any, have finished
+	void Wait();
+
+	/// Whether a sort is running on a worker thread, including sorts cancelled by a change of sort specs until they return
+	bool IsSorting() const;
+
+	/// Number of rows displayed
+	int32 Num() const { return DisplayedRows.IsValid() ? DisplayedRows->Num() : 0; }
+
+	/// Returns the row index displayed at a position
+	int32 operator[](int32 DisplayIndex) const { return (*DisplayedRows)[DisplayIndex]; }
+
+	/// Calls DrawRow for every visible row in display order using ImGuiListClipper
+	void DrawRows(TFunctionRef<void(int32 RowIndex)> DrawRow) const;
+
+	/// Number of sort orders kept around for when the sort specs change back
+	int32 MaxCachedOrders = 4;
+
+	/// Tables with fewer rows than this are sorted synchronously in Update
+	int32 AsyncRowThreshold = 16 * 1024;
+
+private:
+	struct FCachedOrder;
+	struct FSortJob;
+
+	void StartSort(const TSharedRef<FCachedOrder>& Order, int32 RowCount);
+	void CancelSort();
+	void CollectSort();
+
+	FCompareRows CompareRows;
+	TArray<TSharedRef<FCachedOrder>> CachedOrders;
+	TSharedPtr<FSortJob> Job;
+
+	/// Jobs cancelled while running, kept until they return so the destructor can wait for them
+	TArray<TSharedRef<FSortJob>> CancelledJobs;
+
+	TSharedPtr<const TArray<int32>> DisplayedRows;
+	uint64 UpdateCount = 0;
+};
@@ -68,6 +68,7 @@ CODE
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer, ImGuiTextIndex
+// [SECTION] ImGuiLargeText
 // [SECTION] ImGuiListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
@@ -1886,24 +1887,84 @@ const ImWchar* ImStrbolW(const ImWchar* buf_mid_line, const ImWchar* buf_begin)
     return buf_mid_line;
 }
 
+// Case-insensitive substring search, used by ImGuiTextFilter::PassFilter() on every line of large lists.
+// With SSE2/NEON available, 16 candidate positions are tested at once against both the first and last character of the needle
+// (case folded the same way as ImToUpper(), non-ASCII bytes are compared as-is), and only positions passing both are compared in full.
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_STRISTR_SIMD
+static inline int ImStristrMatchMask16(const char* p, const char* p_last, char first_upper, char last_upper)
+{
+    // 'a'..'z' are moved to the bottom of the signed range so a single signed compare identifies them
+    const __m128i lower_bias = _mm_set1_epi8((char)(0x80 - 'a'));
+    const __m128i lower_limit = _mm_set1_epi8((char)(-128 + 26));
+    const __m128i case_bit = _mm_set1_epi8(0x20);
+    __m128i v0 = _mm_loadu_si128((const __m128i*)(const void*)p);
+    __m128i v1 = _mm_loadu_si128((const __m128i*)(const void*)p_last);
+    v0 = _mm_sub_epi8(v0, _mm_and_si128(_mm_cmplt_epi8(_mm_add_epi8(v0, lower_bias), lower_limit), case_bit));
+    v1 = _mm_sub_epi8(v1, _mm_and_si128(_mm_cmplt_epi8(_mm_add_epi8(v1, lower_bias), lower_limit), case_bit));
+    const __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(v0, _mm_set1_epi8(first_upper)), _mm_cmpeq_epi8(v1, _mm_set1_epi8(last_upper)));
+    return _mm_movemask_epi8(eq);
+}
+#elif defined(IMGUI_ENABLE_NEON)
+#define IMGUI_STRISTR_SIMD
+static inline int ImStristrMatchMask16(const char* p, const char* p_last, char first_upper, char last_upper)
+{
+    const uint8x16_t lower_a = vdupq_n_u8('a');
+    const uint8x16_t lower_count = vdupq_n_u8(26);
+    const uint8x16_t case_bit = vdupq_n_u8(0x20);
+    uint8x16_t v0 = vld1q_u8((const uint8_t*)p);
+    uint8x16_t v1 = vld1q_u8((const uint8_t*)p_last);
+    v0 = vsubq_u8(v0, vandq_u8(vcltq_u8(vsubq_u8(v0, lower_a), lower_count), case_bit));
+    v1 = vsubq_u8(v1, vandq_u8(vcltq_u8(vsubq_u8(v1, lower_a), lower_count), case_bit));
+    const uint8x16_t eq = vandq_u8(vceqq_u8(v0, vdupq_n_u8((uint8_t)first_upper)), vceqq_u8(v1, vdupq_n_u8((uint8_t)last_upper)));
+    if (vmaxvq_u8(eq) == 0)
+        return 0;
+    // No movemask on NEON: gather one bit per lane
+    static const uint8_t lane_bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t bits = vandq_u8(eq, vld1q_u8(lane_bits));
+    return vaddv_u8(vget_low_u8(bits)) | (vaddv_u8(vget_high_u8(bits)) << 8);
+}
+#endif
+
 const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
 {
     if (!needle_end)
         needle_end = needle + strlen(needle);
+    if (!haystack_end)
+        haystack_end = haystack + strlen(haystack);
 
-    const char un0 = (char)ImToUpper(*needle);
-    while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end))
+    const int needle_len = (int)(needle_end - needle);
+    if (needle_len == 0 || haystack_end - haystack < needle_len)
+        return NULL;
+
+    const char un0 = ImToUpper(needle[0]);
+    const char un_last = ImToUpper(needle_end[-1]);
+    const char* haystack_last = haystack_end - needle_len; // Last position where the needle fits
+#ifdef IMGUI_STRISTR_SIMD
+    for (; haystack + 16 <= haystack_last + 1; haystack += 16)
     {
-        if (ImToUpper(*haystack) == un0)
+        int mask = ImStristrMatchMask16(haystack, haystack + needle_len - 1, un0, un_last);
+        for (int n = 0; mask != 0; n++, mask >>= 1)
         {
-            const char* b = needle + 1;
-            for (const char* a = haystack + 1; b < needle_end; a++, b++)
-                if (ImToUpper(*a) != ImToUpper(*b))
-                    break;
-            if (b == needle_end)
-                return haystack;
+            if ((mask & 1) == 0)
+                continue;
+            int i = 1;
+            while (i < needle_len - 1 && ImToUpper(haystack[n + i]) == ImToUpper(needle[i]))
+                i++;
+            if (i >= needle_len - 1)
+                return haystack + n;
         }
-        haystack++;
+    }
+#endif
+    for (; haystack <= haystack_last; haystack++)
+    {
+        if (ImToUpper(*haystack) != un0 || ImToUpper(haystack[needle_len - 1]) != un_last)
+            continue;
+        int i = 1;
+        while (i < needle_len - 1 && ImToUpper(haystack[i]) == ImToUpper(needle[i]))
+            i++;
+        if (i >= needle_len - 1)
+            return haystack;
     }
     return NULL;
 }
@@ -2654,6 +2715,8 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
 
     if (text == NULL)
         text = "";
+    if (text_end == NULL)
+        text_end = text + strlen(text); // Measure once rather than once per filter
 
     for (const ImGuiTextRange& f : Filters)
     {
@@ -2763,6 +2826,352 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
     EndOffset = ImMax(EndOffset, new_size);
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiLargeText
+//-----------------------------------------------------------------------------
+// Piece table storage used by InputTextMultilineLarge(). Pieces refer to ranges of either the original text or the append-only
+// added text, with PieceStarts[] holding their offset in the edited text for binary searching. Line starts are maintained
+// incrementally on every edit so that the cost of an edit is bound by the number of pieces and lines, never by a copy of the text.
+//-----------------------------------------------------------------------------
+
+ImGuiLargeText::ImGuiLargeText()
+{
+    Length = 0;
+    LineStartsShiftFrom = LineStartsShift = 0;
+    Cursor = SelectAnchor = 0;
+    CursorAnim = 0.0f;
+    PreferredX = -1.0f;
+    CursorFollow = false;
+    MaxLineWidth = 0.0f;
+    UndoStackMax = 1000;
+    LineStarts.push_back(0);
+}
+
+void ImGuiLargeText::SetText(const char* text, const char* text_end)
+{
+    if (!text_end)
+        text_end = text + strlen(text);
+    const int len = (int)(text_end - text);
+
+    OriginalBuf.resize(len);
+    if (len > 0)
+        memcpy(OriginalBuf.Data, text, (size_t)len);
+    AddedBuf.resize(0);
+    Pieces.resize(0);
+    PieceStarts.resize(0);
+    if (len > 0)
+    {
+        Piece piece = { 0, len, false };
+        Pieces.push_back(piece);
+        PieceStarts.push_back(0);
+    }
+    Length = len;
+
+    LineStarts.resize(0);
+    LineStarts.push_back(0);
+    LineStartsShiftFrom = LineStartsShift = 0;
+    for (const char* p = text; (p = (const char*)memchr(p, '\n', text_end - p)) != NULL; )
+        LineStarts.push_back((int)(++p - text));
+
+    Cursor = SelectAnchor = 0;
+    PreferredX = -1.0f;
+    MaxLineWidth = 0.0f;
+    UndoStack.clear_destruct();
+    RedoStack.clear_destruct();
+}
+
+int ImGuiLargeText::GetLineFromOffset(int offset) const
+{
+    // Last line starting at or before 'offset'
+    int lo = 0, hi = LineStarts.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) / 2;
+        if (GetLineStart(mid) <= offset)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+int ImGuiLargeText::_FindPiece(int offset) const
+{
+    if (offset >= Length)
+        return Pieces.Size;
+    int lo = 0, hi = Pieces.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) / 2;
+        if (PieceStarts[mid] <= offset)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return lo;
+}
+
+char ImGuiLargeText::GetChar(int offset) const
+{
+    const int piece_n = _FindPiece(offset);
+    if (piece_n >= Pieces.Size)
+        return 0;
+    const Piece& piece = Pieces[piece_n];
+    return (piece.Added ? AddedBuf : OriginalBuf)[piece.Offset + offset - PieceStarts[piece_n]];
+}
+
+void ImGuiLargeText::GetText(int begin, int end, ImVector<char>* out) const
+{
+    IM_ASSERT(begin >= 0 && begin <= end && end <= Length);
+    out->resize(end - begin + 1);
+    char* dst = out->Data;
+    for (int piece_n = _FindPiece(begin); piece_n < Pieces.Size && begin < end; piece_n++)
+    {
+        const Piece& piece = Pieces[piece_n];
+        const int piece_begin = begin - PieceStarts[piece_n];
+        const int copy_len = ImMin(piece.Length - piece_begin, end - begin);
+        memcpy(dst, (piece.Added ? AddedBuf : OriginalBuf).Data + piece.Offset + piece_begin, (size_t)copy_len);
+        dst += copy_len;
+        begin += copy_len;
+    }
+    *dst = 0;
+}
+
+const char* ImGuiLargeText::GetLine(int line, const char** out_line_end)
+{
+    const int begin = GetLineStart(line);
+    const int end = GetLineEnd(line);
+
+    // Most lines are held by a single piece and can be read in place
+    const int piece_n = _FindPiece(begin);
+    if (piece_n < Pieces.Size && end <= PieceStarts[piece_n] + Pieces[piece_n].Length)
+    {
+        const Piece& piece = Pieces[piece_n];
+        const char* line_begin = (piece.Added ? AddedBuf : OriginalBuf).Data + piece.Offset + begin - PieceStarts[piece_n];
+        *out_line_end = line_begin + (end - begin);
+        return line_begin;
+    }
+
+    GetText(begin, end, &LineBuf);
+    *out_line_end = LineBuf.Data + (end - begin);
+    return LineBuf.Data;
+}
+
+int ImGuiLargeText::_SplitPiece(int offset)
+{
+    const int piece_n = _FindPiece(offset);
+    if (piece_n >= Pieces.Size || PieceStarts[piece_n] == offset)
+        return piece_n;
+
+    const Piece piece = Pieces[piece_n];
+    const int left_len = offset - PieceStarts[piece_n];
+    Pieces[piece_n].Length = left_len;
+    const Piece right = { piece.Offset + left_len, piece.Length - left_len, piece.Added };
+    Pieces.insert(Pieces.Data + piece_n + 1, right);
+    PieceStarts.insert(PieceStarts.Data + piece_n + 1, offset);
+    return piece_n + 1;
+}
+
+void ImGuiLargeText::Insert(int offset, const char* text, const char* text_end, bool record_undo)
+{
+    if (!text_end)
+        text_end = text + strlen(text);
+    const int len = (int)(text_end - text);
+    IM_ASSERT(offset >= 0 && offset <= Length);
+    if (len <= 0)
+        return;
+
+    // Inserting from our own added buffer would be invalidated by growing it
+    ImVector<char> text_copy;
+    if (AddedBuf.Data && text >= AddedBuf.Data && text < AddedBuf.Data + AddedBuf.Capacity)
+    {
+        text_copy.resize(len);
+        memcpy(text_copy.Data, text, (size_t)len);
+        text = text_copy.Data;
+        text_end = text + len;
+    }
+
+    if (record_undo)
+        _RecordUndo(true, offset, text, len);
+
+    // Typing extends the piece we last appended to, otherwise insert a new piece
+    int piece_n = offset > 0 ? _FindPiece(offset - 1) : Pieces.Size;
+    if (piece_n < Pieces.Size && Pieces[piece_n].Added && PieceStarts[piece_n] + Pieces[piece_n].Length == offset && Pieces[piece_n].Offset + Pieces[piece_n].Length == AddedBuf.Size)
+    {
+        Pieces[piece_n].Length += len;
+    }
+    else
+    {
+        piece_n = _SplitPiece(offset);
+        const Piece piece = { AddedBuf.Size, len, true };
+        Pieces.insert(Pieces.Data + piece_n, piece);
+        PieceStarts.insert(PieceStarts.Data + piece_n, offset);
+    }
+    for (int* p = PieceStarts.Data + piece_n + 1, *p_end = PieceStarts.Data + PieceStarts.Size; p < p_end; p++)
+        *p += len;
+
+    const int added_offset = AddedBuf.Size;
+    AddedBuf.resize(added_offset + len);
+    memcpy(AddedBuf.Data + added_offset, text, (size_t)len);
+
+    // Shift following lines and add the new ones
+    const int line = GetLineFromOffset(offset);
+    _ShiftLines(line + 1, len);
+    int new_lines_count = 0;
+    for (const char* p = text; (p = (const char*)memchr(p, '\n', text_end - p)) != NULL; p++)
+        new_lines_count++;
+    if (new_lines_count > 0)
+    {
+        const int insert_n = line + 1;
+        LineStarts.resize(LineStarts.Size + new_lines_count);
+        memmove(LineStarts.Data + insert_n + new_lines_count, LineStarts.Data + insert_n, (size_t)(LineStarts.Size - new_lines_count - insert_n) * sizeof(int));
+        if (insert_n < LineStartsShiftFrom)
+            LineStartsShiftFrom += new_lines_count;
+        const int stored_shift = (insert_n >= LineStartsShiftFrom) ? LineStartsShift : 0;
+        int* dst = LineStarts.Data + insert_n;
+        for (const char* p = text; (p = (const char*)memchr(p, '\n', text_end - p)) != NULL; )
+            *dst++ = offset + (int)(++p - text) - stored_shift;
+    }
+
+    Length += len;
+}
+
+void ImGuiLargeText::Erase(int offset, int length, bool record_undo)
+{
+    IM_ASSERT(offset >= 0 && offset <= Length);
+    length = ImMin(length, Length - offset);
+    if (length <= 0)
+        return;
+
+    if (record_undo)
+    {
+        ImVector<char> erased;
+        GetText(offset, offset + length, &erased);
+        _RecordUndo(false, offset, erased.Data, length);
+    }
+
+    const int piece_begin = _SplitPiece(offset);
+    const int piece_end = _SplitPiece(offset + length);
+    Pieces.erase(Pieces.Data + piece_begin, Pieces.Data + piece_end);
+    PieceStarts.erase(PieceStarts.Data + piece_begin, PieceStarts.Data + piece_end);
+    for (int* p = PieceStarts.Data + piece_begin, *p_end = PieceStarts.Data + PieceStarts.Size; p < p_end; p++)
+        *p -= length;
+
+    // Lines starting after an erased '\n' go away, the following ones are shifted back
+    const int line_begin = GetLineFromOffset(offset) + 1;
+    const int line_end = GetLineFromOffset(offset + length) + 1;
+    if (line_end > line_begin)
+    {
+        LineStarts.erase(LineStarts.Data + line_begin, LineStarts.Data + line_end);
+        if (LineStartsShiftFrom > line_end)
+            LineStartsShiftFrom -= line_end - line_begin;
+        else if (LineStartsShiftFrom > line_begin)
+            LineStartsShiftFrom = line_begin;
+    }
+    _ShiftLines(line_begin, -length);
+
+    Length -= length;
+}
+
+// Add 'delta' to the start of all lines from 'first_line'. Repeated edits around the same place (i.e. typing) only need to
+// update the lines between the previous and current edit, the rest of the shift is kept pending in LineStartsShift.
+void ImGuiLargeText::_ShiftLines(int first_line, int delta)
+{
+    if (first_line >= LineStartsShiftFrom)
+    {
+        for (int* p = LineStarts.Data + LineStartsShiftFrom, *p_end = LineStarts.Data + first_line; p < p_end; p++)
+            *p += LineStartsShift;
+    }
+    else
+    {
+        for (int* p = LineStarts.Data + first_line, *p_end = LineStarts.Data + LineStartsShiftFrom; p < p_end; p++)
+            *p -= LineStartsShift;
+    }
+    LineStartsShiftFrom = first_line;
+    LineStartsShift += delta;
+}
+
+void ImGuiLargeText::_RecordUndo(bool inserted, int offset, const char* text, int length)
+{
+    RedoStack.clear_destruct();
+
+    // Merge typing and repeated backspace/delete into a single record
+    const bool is_small_edit = length <= 4 && text[0] != '\n';
+    if (is_small_edit && UndoStack.Size > 0 && UndoStack.back().Inserted == inserted && UndoStack.back().Text.Size < 256)
+    {
+        UndoRecord& last = UndoStack.back();
+        if (inserted && last.Offset + last.Text.Size == offset)
+        {
+            last.Text.resize(last.Text.Size + length);
+            memcpy(last.Text.Data + last.Text.Size - length, text, (size_t)length);
+            return;
+        }
+        if (!inserted && last.Offset == offset)
+        {
+            last.Text.resize(last.Text.Size + length);
+            memcpy(last.Text.Data + last.Text.Size - length, text, (size_t)length);
+            return;
+        }
+        if (!inserted && offset + length == last.Offset)
+        {
+            last.Text.resize(last.Text.Size + length);
+            memmove(last.Text.Data + length, last.Text.Data, (size_t)(last.Text.Size - length));
+            memcpy(last.Text.Data, text, (size_t)length);
+            last.Offset = offset;
+            return;
+        }
+    }
+
+    if (UndoStack.Size >= UndoStackMax && UndoStack.Size > 0)
+    {
+        UndoStack[0].Text.clear();
+        UndoStack.erase(UndoStack.Data);
+    }
+    UndoStack.push_back(UndoRecord());
+    UndoRecord& record = UndoStack.back();
+    record.Offset = offset;
+    record.CursorBefore = Cursor;
+    record.Inserted = inserted;
+    record.Text.resize(length);
+    memcpy(record.Text.Data, text, (size_t)length);
+}
+
+bool ImGuiLargeText::Undo()
+{
+    if (UndoStack.Size == 0)
+        return false;
+    RedoStack.push_back(UndoRecord());
+    UndoRecord& record = RedoStack.back();
+    record = UndoStack.back();
+    UndoStack.back().Text.clear();
+    UndoStack.pop_back();
+
+    if (record.Inserted)
+        Erase(record.Offset, record.Text.Size, false);
+    else
+        Insert(record.Offset, record.Text.Data, record.Text.Data + record.Text.Size, false);
+    Cursor = SelectAnchor = record.CursorBefore;
+    return true;
+}
+
+bool ImGuiLargeText::Redo()
+{
+    if (RedoStack.Size == 0)
+        return false;
+    UndoStack.push_back(UndoRecord());
+    UndoRecord& record = UndoStack.back();
+    record = RedoStack.back();
+    RedoStack.back().Text.clear();
+    RedoStack.pop_back();
+
+    if (record.Inserted)
+        Insert(record.Offset, record.Text.Data, record.Text.Data + record.Text.Size, false);
+    else
+        Erase(record.Offset, record.Text.Size, false);
+    Cursor = SelectAnchor = record.Inserted ? record.Offset + record.Text.Size : record.Offset;
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiListClipper
 //-----------------------------------------------------------------------------
@@ -20398,6 +20807,8 @@ void ImGui::DebugNodeFont(ImFont* font)
     Text("Ellipsis character: '%s' (U+%04X)", ImTextCharToUtf8(c_str, font->EllipsisChar), font->EllipsisChar);
     const int surface_sqrt = (int)ImSqrt((float)font->MetricsTotalSurface);
     Text("Texture Area: about %d px ~%dx%d px", font->MetricsTotalSurface, surface_sqrt, surface_sqrt);
+    if (ImFontLayoutCache* layout_cache = font->LayoutCache)
+        Text("Layout cache: %d/%d entries, %d hits, %d misses", layout_cache->EntriesUsed, layout_cache->Entries.Size, layout_cache->MetricsHits, layout_cache->MetricsMisses);
     for (int config_i = 0; config_i < font->ConfigDataCount; config_i++)
         if (font->ConfigData)
             if (const ImFontConfig* cfg = &font->ConfigData[config_i])
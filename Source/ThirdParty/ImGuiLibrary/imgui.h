@@ -148,6 +148,7 @@ struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_t
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
+struct ImFontLayoutCache;           // Optional per-font cache of measured and laid out text (opaque structure, unless including imgui_internal.h)
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
@@ -165,6 +166,7 @@ struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
+struct ImGuiLargeText;              // Helper to hold and edit large texts with InputTextMultilineLarge() (piece table + line index)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
 struct ImGuiViewport;               // A Platform Window (always 1 unless multi-viewport are enabled. One per platform window to output to). In the future may represent Platform Monitor
 struct ImGuiWindowClass;            // Window class (rare/advanced uses: provide hints to the platform backend via altered viewport flags and parent/child info)
@@ -604,6 +606,7 @@ namespace ImGui
     IMGUI_API bool          InputText(const char* label, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool          InputTextMultiline(const char* label, char* buf, size_t buf_size, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool          InputTextWithHint(const char* label, const char* hint, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
+    IMGUI_API bool          InputTextMultilineLarge(const char* label, ImGuiLargeText* text, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0); // Multi-line editor for large texts (MBs): cost of activation and edits doesn't depend on text size. Supports ReadOnly, AllowTabInput, CtrlEnterForNewLine, NoUndoRedo flags.
     IMGUI_API bool          InputFloat(const char* label, float* v, float step = 0.0f, float step_fast = 0.0f, const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
     IMGUI_API bool          InputFloat2(const char* label, float v[2], const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
     IMGUI_API bool          InputFloat3(const char* label, float v[3], const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
@@ -2489,6 +2492,64 @@ struct ImGuiTextBuffer
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
 };
 
+// Helper: Editable text storage for InputTextMultilineLarge()
+// - Text is stored as a piece table: the initial text is never moved, inserted text is appended to a second buffer and the
+//   list of pieces refers to ranges of either, so the cost of an edit depends on the number of pieces rather than the text size.
+// - Line start offsets are updated on every edit, so readers only need to access, convert and measure the lines they display.
+// - Editing state (cursor, selection, undo) is stored here too, a text can be edited by one widget at a time.
+struct ImGuiLargeText
+{
+    struct Piece        { int Offset; int Length; bool Added; };
+    struct UndoRecord   { int Offset; int CursorBefore; bool Inserted; ImVector<char> Text; };
+
+    ImVector<char>      OriginalBuf;        // Text passed to SetText()
+    ImVector<char>      AddedBuf;           // Text inserted since, append-only
+    ImVector<Piece>     Pieces;
+    ImVector<int>       PieceStarts;        // Text offset of each piece
+    ImVector<int>       LineStarts;         // Text offset of each line, use GetLineStart() as a shift may be pending
+    int                 LineStartsShiftFrom;// Lines starting from this one are offset by LineStartsShift (applied lazily so typing doesn't touch every following line)
+    int                 LineStartsShift;
+    int                 Length;
+
+    // Editing state
+    int                 Cursor;
+    int                 SelectAnchor;       // Selection is between SelectAnchor and Cursor
+    float               CursorAnim;
+    float               PreferredX;         // Horizontal position kept when moving up/down, < 0.0f when unset
+    bool                CursorFollow;
+    float               MaxLineWidth;       // Widest line measured so far, only visible lines are measured
+    ImVector<UndoRecord> UndoStack;
+    ImVector<UndoRecord> RedoStack;
+    int                 UndoStackMax;
+    ImVector<char>      LineBuf;            // Scratch buffer holding the line being read
+
+    IMGUI_API ImGuiLargeText();
+    ~ImGuiLargeText()                       { UndoStack.clear_destruct(); RedoStack.clear_destruct(); }
+    IMGUI_API void      SetText(const char* text, const char* text_end = NULL);     // Replace the whole text, clears undo
+    void                Clear()                             { SetText(""); }
+    int                 GetLength() const                   { return Length; }
+    int                 GetLineCount() const                { return LineStarts.Size; }
+    int                 GetLineStart(int line) const        { return LineStarts[line] + (line >= LineStartsShiftFrom ? LineStartsShift : 0); }
+    int                 GetLineEnd(int line) const          { return line + 1 < LineStarts.Size ? GetLineStart(line + 1) - 1 : Length; } // Excluding '\n'
+    IMGUI_API int       GetLineFromOffset(int offset) const;
+    IMGUI_API char      GetChar(int offset) const;
+    IMGUI_API void      GetText(int begin, int end, ImVector<char>* out) const;    // Copy a range into out, zero-terminated
+    IMGUI_API const char* GetLine(int line, const char** out_line_end);             // Line contents (excluding '\n'), valid until the next edit or call to GetLine()
+    IMGUI_API void      Insert(int offset, const char* text, const char* text_end = NULL, bool record_undo = true);
+    IMGUI_API void      Erase(int offset, int length, bool record_undo = true);
+    IMGUI_API bool      Undo();
+    IMGUI_API bool      Redo();
+    bool                HasSelection() const                { return SelectAnchor != Cursor; }
+    int                 GetSelectionStart() const           { return SelectAnchor < Cursor ? SelectAnchor : Cursor; }
+    int                 GetSelectionEnd() const             { return SelectAnchor > Cursor ? SelectAnchor : Cursor; }
+
+    // [Internal]
+    IMGUI_API int       _FindPiece(int offset) const;       // Index of the piece holding 'offset', or Pieces.Size at the end of the text
+    IMGUI_API int       _SplitPiece(int offset);            // Ensure a piece starts at 'offset' and return its index
+    IMGUI_API void      _ShiftLines(int first_line, int delta);
+    IMGUI_API void      _RecordUndo(bool inserted, int offset, const char* text, int length);
+};
+
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
@@ -3174,6 +3235,7 @@ struct ImFont
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
     ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
+    ImFontLayoutCache*          LayoutCache;        // 4-8   // out // = NULL     // Optional cache for CalcTextSizeA()/RenderText() results, see SetLayoutCacheCapacity().
 
     // Methods
     IMGUI_API ImFont();
@@ -3191,6 +3253,10 @@ struct ImFont
     IMGUI_API void              RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c) const;
     IMGUI_API void              RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width = 0.0f, bool cpu_fine_clip = false) const;
 
+    // Enable caching of CalcTextSizeA() sizes and word-wrapped RenderText() glyph quads, keyed by text, size and wrap width, for up to 'capacity' strings (least recently used are evicted). 0 to disable.
+    // Useful for UI re-submitting the same labels every frame. Only short strings are cached (see IM_FONT_LAYOUT_CACHE_MAX_TEXT_LEN). The cache is cleared when the font is rebuilt.
+    IMGUI_API void              SetLayoutCacheCapacity(int capacity);
+
     // [Internal] Don't use!
     IMGUI_API void              BuildLookupTable();
     IMGUI_API void              ClearOutputData();
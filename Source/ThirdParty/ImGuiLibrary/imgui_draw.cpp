@@ -710,6 +710,147 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Tessellation kernels shared by AddPolyline() and AddConvexPolyFilled().
+// - The SSE/NEON paths process two points per register and fall back to the scalar macros above for the remainder.
+// - They are written to produce bit-identical results to the scalar path: same operation order, no fused multiply-add,
+//   _mm_rsqrt_ps() matching ImRsqrt()'s _mm_rsqrt_ss(), and IEEE div/sqrt on NEON matching the non-SSE ImRsqrt().
+#if defined(IMGUI_ENABLE_SSE)
+#define IM_POLY_SIMD_WIDTH                  2   // Number of ImVec2 per register
+typedef __m128 ImPolyVec;
+static inline ImPolyVec ImPolyLoad(const ImVec2* p)                         { return _mm_loadu_ps(&p->x); }
+static inline ImPolyVec ImPolySet1(float v)                                 { return _mm_set1_ps(v); }
+static inline ImPolyVec ImPolyAdd(ImPolyVec a, ImPolyVec b)                 { return _mm_add_ps(a, b); }
+static inline ImPolyVec ImPolySub(ImPolyVec a, ImPolyVec b)                 { return _mm_sub_ps(a, b); }
+static inline ImPolyVec ImPolyMul(ImPolyVec a, ImPolyVec b)                 { return _mm_mul_ps(a, b); }
+static inline ImPolyVec ImPolySwapXY(ImPolyVec a)                           { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)); }
+static inline ImPolyVec ImPolyNegY(ImPolyVec a)                             { return _mm_xor_ps(a, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f)); }
+static inline ImPolyVec ImPolyLength2(ImPolyVec a)                          { ImPolyVec sq = _mm_mul_ps(a, a); return _mm_add_ps(sq, ImPolySwapXY(sq)); }
+static inline ImPolyVec ImPolyRsqrt(ImPolyVec a)                            { return _mm_rsqrt_ps(a); }
+static inline ImPolyVec ImPolyRcp(ImPolyVec a)                              { return _mm_div_ps(_mm_set1_ps(1.0f), a); }
+static inline ImPolyVec ImPolyMinConst(float c, ImPolyVec a)                { return _mm_min_ps(_mm_set1_ps(c), a); } // == (a > c) ? c : a, including NaN propagation
+static inline ImPolyVec ImPolySelectGt(ImPolyVec a, float c, ImPolyVec t, ImPolyVec f) { ImPolyVec m = _mm_cmpgt_ps(a, _mm_set1_ps(c)); return _mm_or_ps(_mm_and_ps(m, t), _mm_andnot_ps(m, f)); }
+static inline void      ImPolyStore(ImVec2* p, ImPolyVec a)                 { _mm_storeu_ps(&p->x, a); }
+static inline void      ImPolyStoreLo(ImVec2* p, ImPolyVec a)               { _mm_storel_pi((__m64*)(void*)p, a); }
+static inline void      ImPolyStoreHi(ImVec2* p, ImPolyVec a)               { _mm_storeh_pi((__m64*)(void*)p, a); }
+#elif defined(IMGUI_ENABLE_NEON)
+#define IM_POLY_SIMD_WIDTH                  2
+typedef float32x4_t ImPolyVec;
+static inline ImPolyVec ImPolyLoad(const ImVec2* p)                         { return vld1q_f32(&p->x); }
+static inline ImPolyVec ImPolySet1(float v)                                 { return vdupq_n_f32(v); }
+static inline ImPolyVec ImPolyAdd(ImPolyVec a, ImPolyVec b)                 { return vaddq_f32(a, b); }
+static inline ImPolyVec ImPolySub(ImPolyVec a, ImPolyVec b)                 { return vsubq_f32(a, b); }
+static inline ImPolyVec ImPolyMul(ImPolyVec a, ImPolyVec b)                 { return vmulq_f32(a, b); }
+static inline ImPolyVec ImPolySwapXY(ImPolyVec a)                           { return vrev64q_f32(a); }
+static inline ImPolyVec ImPolyNegY(ImPolyVec a)                             { static const uint32_t sign_mask[4] = { 0, 0x80000000, 0, 0x80000000 }; return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vld1q_u32(sign_mask))); }
+static inline ImPolyVec ImPolyLength2(ImPolyVec a)                          { ImPolyVec sq = vmulq_f32(a, a); return vaddq_f32(sq, vrev64q_f32(sq)); }
+static inline ImPolyVec ImPolyRsqrt(ImPolyVec a)                            { return vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(a)); }
+static inline ImPolyVec ImPolyRcp(ImPolyVec a)                              { return vdivq_f32(vdupq_n_f32(1.0f), a); }
+static inline ImPolyVec ImPolyMinConst(float c, ImPolyVec a)                { return vbslq_f32(vcgtq_f32(a, vdupq_n_f32(c)), vdupq_n_f32(c), a); }
+static inline ImPolyVec ImPolySelectGt(ImPolyVec a, float c, ImPolyVec t, ImPolyVec f) { return vbslq_f32(vcgtq_f32(a, vdupq_n_f32(c)), t, f); }
+static inline void      ImPolyStore(ImVec2* p, ImPolyVec a)                 { vst1q_f32(&p->x, a); }
+static inline void      ImPolyStoreLo(ImVec2* p, ImPolyVec a)               { vst1_f32(&p->x, vget_low_f32(a)); }
+static inline void      ImPolyStoreHi(ImVec2* p, ImPolyVec a)               { vst1_f32(&p->x, vget_high_f32(a)); }
+#endif
+
+// Compute the normal of each segment [i, i+1] (wrapping around the last point) for i in [0, count).
+static void ImPolyComputeNormals(const ImVec2* points, const int points_count, const int count, ImVec2* out_normals)
+{
+    int i1 = 0;
+#ifdef IM_POLY_SIMD_WIDTH
+    for (; i1 + IM_POLY_SIMD_WIDTH < points_count && i1 + IM_POLY_SIMD_WIDTH <= count; i1 += IM_POLY_SIMD_WIDTH)
+    {
+        ImPolyVec d = ImPolySub(ImPolyLoad(&points[i1 + 1]), ImPolyLoad(&points[i1]));
+        ImPolyVec d2 = ImPolyLength2(d);
+        d = ImPolySelectGt(d2, 0.0f, ImPolyMul(d, ImPolyRsqrt(d2)), d);
+        ImPolyStore(&out_normals[i1], ImPolyNegY(ImPolySwapXY(d)));
+    }
+#endif
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i1].x = dy;
+        out_normals[i1].y = -dx;
+    }
+}
+
+// Compute the averaged (miter) normal at each point i in [i_begin, i_end) from the normals of segments [i-1] and [i], wrapping around.
+static void ImPolyComputeMiters(const ImVec2* normals, const int normals_count, const int i_begin, const int i_end, ImVec2* out_miters)
+{
+    int i1 = i_begin;
+    if (i1 == 0 && i1 < i_end)
+    {
+        const ImVec2& n0 = normals[normals_count - 1];
+        const ImVec2& n1 = normals[0];
+        float dm_x = (n0.x + n1.x) * 0.5f;
+        float dm_y = (n0.y + n1.y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_miters[0].x = dm_x;
+        out_miters[0].y = dm_y;
+        i1++;
+    }
+#ifdef IM_POLY_SIMD_WIDTH
+    const ImPolyVec half = ImPolySet1(0.5f);
+    for (; i1 + IM_POLY_SIMD_WIDTH <= i_end; i1 += IM_POLY_SIMD_WIDTH)
+    {
+        ImPolyVec dm = ImPolyMul(ImPolyAdd(ImPolyLoad(&normals[i1 - 1]), ImPolyLoad(&normals[i1])), half);
+        ImPolyVec d2 = ImPolyLength2(dm);
+        ImPolyVec inv_len2 = ImPolyMinConst(IM_FIXNORMAL2F_MAX_INVLEN2, ImPolyRcp(d2));
+        ImPolyStore(&out_miters[i1], ImPolySelectGt(d2, 0.000001f, ImPolyMul(dm, inv_len2), dm));
+    }
+#endif
+    for (; i1 < i_end; i1++)
+    {
+        const ImVec2& n0 = normals[i1 - 1];
+        const ImVec2& n1 = normals[i1];
+        float dm_x = (n0.x + n1.x) * 0.5f;
+        float dm_y = (n0.y + n1.y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_miters[i1].x = dm_x;
+        out_miters[i1].y = dm_y;
+    }
+}
+
+// Offset each point i in [i_begin, i_end) along its miter, writing 'offsets_count * 2' edge points per input point:
+// out[i * offsets_count * 2 + n] = points[i] + miter * offsets[n] for n in [0, offsets_count), followed by the mirrored points[i] - miter * offsets[n] in reverse order.
+static void ImPolyComputeEdgePoints(const ImVec2* points, const ImVec2* miters, const int i_begin, const int i_end, const float* offsets, const int offsets_count, ImVec2* out_points)
+{
+    const int stride = offsets_count * 2;
+    int i = i_begin;
+#ifdef IM_POLY_SIMD_WIDTH
+    for (; i + IM_POLY_SIMD_WIDTH <= i_end; i += IM_POLY_SIMD_WIDTH)
+    {
+        const ImPolyVec p = ImPolyLoad(&points[i]);
+        const ImPolyVec dm = ImPolyLoad(&miters[i]);
+        ImVec2* out0 = &out_points[i * stride];
+        ImVec2* out1 = out0 + stride;
+        for (int n = 0; n < offsets_count; n++)
+        {
+            const ImPolyVec d = ImPolyMul(dm, ImPolySet1(offsets[n]));
+            const ImPolyVec a = ImPolyAdd(p, d);
+            const ImPolyVec b = ImPolySub(p, d);
+            ImPolyStoreLo(&out0[n], a); ImPolyStoreLo(&out0[stride - 1 - n], b);
+            ImPolyStoreHi(&out1[n], a); ImPolyStoreHi(&out1[stride - 1 - n], b);
+        }
+    }
+#endif
+    for (; i < i_end; i++)
+    {
+        ImVec2* out = &out_points[i * stride];
+        for (int n = 0; n < offsets_count; n++)
+        {
+            const float dm_x = miters[i].x * offsets[n];
+            const float dm_y = miters[i].y * offsets[n];
+            out[n].x = points[i].x + dm_x;
+            out[n].y = points[i].y + dm_y;
+            out[stride - 1 - n].x = points[i].x - dm_x;
+            out[stride - 1 - n].y = points[i].y - dm_y;
+        }
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -746,24 +887,22 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         PrimReserve(idx_count, vtx_count);
 
         // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
+        // The first <points_count> items are normals at each line point, then <points_count> averaged normals, then after that there are either 2 or 4 temp points for each line point
+        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 4 : 6));
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        ImVec2* temp_points = temp_normals + points_count;
+        ImVec2* temp_miters = temp_normals + points_count;
+        ImVec2* temp_points = temp_miters + points_count;
 
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
+        ImPolyComputeNormals(points, points_count, count, temp_normals);
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
 
+        // Calculate averaged normals for each line point, the first point in a closed line being generated from the final segment
+        // The first point of an open line has no normals to blend and is generated separately below
+        const int miter_begin = closed ? 0 : 1;
+        ImPolyComputeMiters(temp_normals, points_count, miter_begin, points_count, temp_miters);
+
         // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
         if (use_texture || !thick_line)
         {
@@ -786,29 +925,16 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // Add temporary vertexes for the outer edges, offsetting the averaged normals to the outer edge of the AA area
+            ImPolyComputeEdgePoints(points, temp_miters, miter_begin, points_count, &half_draw_size, 1, temp_points);
+
+            // Generate the indices to form a number of triangles for each line segment
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertexes for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -882,35 +1008,17 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
+            // Add temporary vertices for the outer (AA) and inner (solid core) edges
+            const float edge_offsets[2] = { half_inner_thickness + AA_SIZE, half_inner_thickness };
+            ImPolyComputeEdgePoints(points, temp_miters, miter_begin, points_count, edge_offsets, 2, temp_points);
+
+            // Generate the indices to form a number of triangles for each line segment
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
@@ -995,34 +1103,21 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             _IdxWritePtr += 3;
         }
 
-        // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
+        // Compute normals, averaged normals and fringe points (outer then inner for each point)
+        _Data->TempBuffer.reserve_discard(points_count * 4);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+        ImVec2* temp_miters = temp_normals + points_count;
+        ImVec2* temp_points = temp_miters + points_count;
+        const float fringe_offset = AA_SIZE * 0.5f;
+        ImPolyComputeNormals(points, points_count, points_count, temp_normals);
+        ImPolyComputeMiters(temp_normals, points_count, 0, points_count, temp_miters);
+        ImPolyComputeEdgePoints(points, temp_miters, 0, points_count, &fringe_offset, 1, temp_points);
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
-
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            _VtxWritePtr[0].pos = temp_points[i1 * 2 + 1]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
+            _VtxWritePtr[1].pos = temp_points[i1 * 2 + 0]; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -3268,11 +3363,13 @@ ImFont::ImFont()
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
+    LayoutCache = NULL;
 }
 
 ImFont::~ImFont()
 {
     ClearOutputData();
+    IM_DELETE(LayoutCache);
 }
 
 void    ImFont::ClearOutputData()
@@ -3287,6 +3384,8 @@ void    ImFont::ClearOutputData()
     DirtyLookupTables = true;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
+    if (LayoutCache)
+        LayoutCache->Clear();
 }
 
 static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_chars, int candidate_chars_count)
@@ -3310,6 +3409,8 @@ void ImFont::BuildLookupTable()
     IndexLookup.clear();
     DirtyLookupTables = false;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
+    if (LayoutCache)
+        LayoutCache->Clear(); // Glyphs positions and UV may have changed
     GrowIndex(max_codepoint + 1);
     for (int i = 0; i < Glyphs.Size; i++)
     {
@@ -3398,6 +3499,8 @@ void ImFont::SetGlyphVisible(ImWchar c, bool visible)
 {
     if (ImFontGlyph* glyph = (ImFontGlyph*)(void*)FindGlyph((ImWchar)c))
         glyph->Visible = visible ? 1 : 0;
+    if (LayoutCache)
+        LayoutCache->Clear();
 }
 
 void ImFont::GrowIndex(int new_size)
@@ -3469,6 +3572,8 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
     GrowIndex(dst + 1);
     IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
     IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    if (LayoutCache)
+        LayoutCache->Clear();
 }
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
@@ -3602,11 +3707,338 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     return s;
 }
 
+void ImFontLayoutCache::SetCapacity(int capacity)
+{
+    IM_ASSERT(capacity > 0);
+    Entries.clear_destruct();
+    Entries.resize(capacity);
+    for (int n = 0; n < Entries.Size; n++)
+        IM_PLACEMENT_NEW(&Entries.Data[n]) ImFontLayoutCacheEntry();
+    int buckets_count = 16;
+    while (buckets_count < capacity * 2) // Keep load factor under 0.5
+        buckets_count <<= 1;
+    Buckets.resize(buckets_count);
+    EntriesUsed = 0;
+    Clear();
+}
+
+void ImFontLayoutCache::Clear()
+{
+    for (int n = 0; n < EntriesUsed; n++)
+    {
+        ImFontLayoutCacheEntry& entry = Entries.Data[n];
+        entry.Key = 0;
+        entry.HasTextSize = entry.HasQuads = false;
+        entry.LruPrev = entry.LruNext = -1;
+    }
+    memset(Buckets.Data, 0xFF, (size_t)Buckets.size_in_bytes()); // -1
+    EntriesUsed = 0;
+    LruHead = LruTail = -1;
+}
+
+void ImFontLayoutCache::_LruUnlink(int entry_idx)
+{
+    ImFontLayoutCacheEntry& entry = Entries.Data[entry_idx];
+    if (entry.LruPrev != -1) Entries.Data[entry.LruPrev].LruNext = entry.LruNext; else LruHead = entry.LruNext;
+    if (entry.LruNext != -1) Entries.Data[entry.LruNext].LruPrev = entry.LruPrev; else LruTail = entry.LruPrev;
+    entry.LruPrev = entry.LruNext = -1;
+}
+
+void ImFontLayoutCache::_LruPushFront(int entry_idx)
+{
+    ImFontLayoutCacheEntry& entry = Entries.Data[entry_idx];
+    entry.LruPrev = -1;
+    entry.LruNext = LruHead;
+    if (LruHead != -1) Entries.Data[LruHead].LruPrev = entry_idx; else LruTail = entry_idx;
+    LruHead = entry_idx;
+}
+
+// Linear probing removal: shift back following entries which can't be reached anymore from their ideal bucket.
+void ImFontLayoutCache::_RemoveBucket(int bucket_idx)
+{
+    const int mask = Buckets.Size - 1;
+    int hole = bucket_idx;
+    for (int next = (hole + 1) & mask; Buckets.Data[next] != -1; next = (next + 1) & mask)
+    {
+        const int ideal = (int)(Entries.Data[Buckets.Data[next]].Key & mask);
+        const bool reachable = (hole <= next) ? (hole < ideal && ideal <= next) : (hole < ideal || ideal <= next);
+        if (!reachable)
+        {
+            Buckets.Data[hole] = Buckets.Data[next];
+            hole = next;
+        }
+    }
+    Buckets.Data[hole] = -1;
+}
+
+// Hash 8 bytes at a time: ImHashData() processes one byte per table lookup which would cost as much as measuring the text again.
+// Quality only matters for probe lengths as hits are verified against a copy of the text.
+static ImGuiID ImFontLayoutCacheHash(const char* text, size_t text_len, float size, float max_width, float wrap_width)
+{
+    const ImU64 k = 0x9E3779B97F4A7C15ULL;
+    ImU64 h = (ImU64)text_len * k;
+    ImU64 v;
+    for (; text_len >= 8; text += 8, text_len -= 8)
+    {
+        memcpy(&v, text, 8);
+        h = (h ^ v) * k;
+        h ^= h >> 29;
+    }
+    v = 0;
+    memcpy(&v, text, text_len);
+    h = (h ^ v) * k;
+    h ^= h >> 29;
+    unsigned int params[3];
+    memcpy(params, &size, 4);
+    memcpy(params + 1, &max_width, 4);
+    memcpy(params + 2, &wrap_width, 4);
+    h = (h ^ params[0] ^ ((ImU64)params[1] << 32)) * k;
+    h = (h ^ params[2]) * k;
+    h ^= h >> 32;
+    return (ImGuiID)h;
+}
+
+// Returns the entry for this text and parameters, recycling the least recently used entry if none exists.
+// A newly added entry has neither HasTextSize nor HasQuads set.
+ImFontLayoutCacheEntry* ImFontLayoutCache::GetOrAdd(const char* text_begin, const char* text_end, float size, float max_width, float wrap_width)
+{
+    const int text_len = (int)(text_end - text_begin);
+    IM_ASSERT(text_len > 0 && Entries.Size > 0);
+    ImGuiID key = ImFontLayoutCacheHash(text_begin, (size_t)text_len, size, max_width, wrap_width);
+    if (key == 0)
+        key = 1; // 0 is reserved for unused entries
+
+    const int mask = Buckets.Size - 1;
+    int bucket_idx = (int)(key & mask);
+    for (int entry_idx; (entry_idx = Buckets.Data[bucket_idx]) != -1; bucket_idx = (bucket_idx + 1) & mask)
+    {
+        ImFontLayoutCacheEntry& entry = Entries.Data[entry_idx];
+        if (entry.Key == key && entry.Size == size && entry.MaxWidth == max_width && entry.WrapWidth == wrap_width && entry.Text.Size == text_len && memcmp(entry.Text.Data, text_begin, (size_t)text_len) == 0)
+        {
+            MetricsHits++;
+            if (LruHead != entry_idx)
+            {
+                _LruUnlink(entry_idx);
+                _LruPushFront(entry_idx);
+            }
+            return &entry;
+        }
+    }
+    MetricsMisses++;
+
+    int entry_idx;
+    if (EntriesUsed < Entries.Size)
+    {
+        entry_idx = EntriesUsed++;
+    }
+    else
+    {
+        // Evict least recently used entry, then find a free bucket again as removal may have shifted others
+        entry_idx = LruTail;
+        _LruUnlink(entry_idx);
+        int old_bucket_idx = (int)(Entries.Data[entry_idx].Key & mask);
+        while (Buckets.Data[old_bucket_idx] != entry_idx)
+            old_bucket_idx = (old_bucket_idx + 1) & mask;
+        _RemoveBucket(old_bucket_idx);
+        bucket_idx = (int)(key & mask);
+        while (Buckets.Data[bucket_idx] != -1)
+            bucket_idx = (bucket_idx + 1) & mask;
+    }
+    Buckets.Data[bucket_idx] = entry_idx;
+
+    ImFontLayoutCacheEntry& entry = Entries.Data[entry_idx];
+    entry.Key = key;
+    entry.Size = size;
+    entry.MaxWidth = max_width;
+    entry.WrapWidth = wrap_width;
+    entry.Text.resize(text_len);
+    memcpy(entry.Text.Data, text_begin, (size_t)text_len);
+    entry.HasTextSize = entry.HasQuads = false;
+    entry.Quads.resize(0);
+    _LruPushFront(entry_idx);
+    return &entry;
+}
+
+// Lay out the visible glyphs of a string relative to its (truncated) position, as RenderText() would without clipping.
+static void ImFontLayoutTextQuads(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end, ImVector<ImFontLayoutQuad>* out_quads)
+{
+    const float scale = size / font->FontSize;
+    const float line_height = font->FontSize * scale;
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+    const char* word_wrap_eol = NULL;
+
+    out_quads->resize(0);
+    float x = 0.0f;
+    float y = 0.0f;
+    const char* s = text_begin;
+    while (s < text_end)
+    {
+        if (word_wrap_enabled)
+        {
+            if (!word_wrap_eol)
+                word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - x);
+
+            if (s >= word_wrap_eol)
+            {
+                x = 0.0f;
+                y += line_height;
+                word_wrap_eol = NULL;
+                s = CalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
+                continue;
+            }
+        }
+
+        // Decode and advance source
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                x = 0.0f;
+                y += line_height;
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+
+        const ImFontGlyph* glyph = font->FindGlyph((ImWchar)c);
+        if (glyph == NULL)
+            continue;
+
+        if (glyph->Visible)
+        {
+            ImFontLayoutQuad quad;
+            quad.X0 = x + glyph->X0 * scale;
+            quad.X1 = x + glyph->X1 * scale;
+            quad.Y0 = y + glyph->Y0 * scale;
+            quad.Y1 = y + glyph->Y1 * scale;
+            quad.U0 = glyph->U0;
+            quad.V0 = glyph->V0;
+            quad.U1 = glyph->U1;
+            quad.V1 = glyph->V1;
+            quad.Colored = glyph->Colored != 0;
+            out_quads->push_back(quad);
+        }
+        x += glyph->AdvanceX * scale;
+    }
+}
+
+// Emit glyph quads laid out by ImFontLayoutTextQuads(), applying the same clipping as RenderText().
+static void ImFontRenderLayoutQuads(ImDrawList* draw_list, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const ImFontLayoutQuad* quads, int quads_count, bool cpu_fine_clip)
+{
+    if (quads_count == 0)
+        return;
+
+    const int idx_expected_size = draw_list->IdxBuffer.Size + quads_count * 6;
+    draw_list->PrimReserve(quads_count * 6, quads_count * 4);
+    ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+
+    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+
+    for (const ImFontLayoutQuad* quad = quads; quad < quads + quads_count; quad++)
+    {
+        float x1 = pos.x + quad->X0;
+        float x2 = pos.x + quad->X1;
+        float y1 = pos.y + quad->Y0;
+        float y2 = pos.y + quad->Y1;
+        if (x1 > clip_rect.z || x2 < clip_rect.x || y1 > clip_rect.w || y2 < clip_rect.y)
+            continue;
+
+        float u1 = quad->U0;
+        float v1 = quad->V0;
+        float u2 = quad->U1;
+        float v2 = quad->V1;
+
+        // CPU side clipping used to fit text in their frame when the frame is too small. Only does clipping for axis aligned quads.
+        if (cpu_fine_clip)
+        {
+            if (x1 < clip_rect.x)
+            {
+                u1 = u1 + (1.0f - (x2 - clip_rect.x) / (x2 - x1)) * (u2 - u1);
+                x1 = clip_rect.x;
+            }
+            if (y1 < clip_rect.y)
+            {
+                v1 = v1 + (1.0f - (y2 - clip_rect.y) / (y2 - y1)) * (v2 - v1);
+                y1 = clip_rect.y;
+            }
+            if (x2 > clip_rect.z)
+            {
+                u2 = u1 + ((clip_rect.z - x1) / (x2 - x1)) * (u2 - u1);
+                x2 = clip_rect.z;
+            }
+            if (y2 > clip_rect.w)
+            {
+                v2 = v1 + ((clip_rect.w - y1) / (y2 - y1)) * (v2 - v1);
+                y2 = clip_rect.w;
+            }
+            if (y1 >= y2)
+                continue;
+        }
+
+        // Support for untinted glyphs
+        ImU32 glyph_col = quad->Colored ? col_untinted : col;
+
+        // Inlined PrimRectUV(), see RenderText()
+        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
+        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
+        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
+        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+        vtx_write += 4;
+        vtx_index += 4;
+        idx_write += 6;
+    }
+
+    // Give back unused vertices (clipped ones)
+    draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data);
+    draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
+    draw_list->CmdBuffer[draw_list->CmdBuffer.Size - 1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_index;
+}
+
+void ImFont::SetLayoutCacheCapacity(int capacity)
+{
+    if (capacity <= 0)
+    {
+        IM_DELETE(LayoutCache);
+        LayoutCache = NULL;
+        return;
+    }
+    if (LayoutCache == NULL)
+        LayoutCache = IM_NEW(ImFontLayoutCache)();
+    if (LayoutCache->Entries.Size != capacity)
+        LayoutCache->SetCapacity(capacity);
+}
+
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining) const
 {
     if (!text_end)
         text_end = text_begin + strlen(text_begin); // FIXME-OPT: Need to avoid this.
 
+    ImFontLayoutCacheEntry* cache_entry = NULL;
+    if (LayoutCache && text_begin < text_end && text_end - text_begin <= IM_FONT_LAYOUT_CACHE_MAX_TEXT_LEN)
+    {
+        cache_entry = LayoutCache->GetOrAdd(text_begin, text_end, size, max_width, wrap_width);
+        if (cache_entry->HasTextSize)
+        {
+            if (remaining)
+                *remaining = text_begin + cache_entry->RemainingOffset;
+            return cache_entry->TextSize;
+        }
+    }
+
     const float line_height = size;
     const float scale = size / FontSize;
 
@@ -3677,6 +4109,13 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     if (remaining)
         *remaining = s;
 
+    if (cache_entry)
+    {
+        cache_entry->TextSize = text_size;
+        cache_entry->RemainingOffset = (int)(s - text_begin);
+        cache_entry->HasTextSize = true;
+    }
+
     return text_size;
 }
 
@@ -3707,6 +4146,20 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     if (y > clip_rect.w)
         return;
 
+    // Emit pre-positioned glyph quads if this text has already been laid out
+    // Only worth it for wrapped text: streaming cached quads costs more than decoding and looking up glyphs again on a single line.
+    if (LayoutCache && wrap_width > 0.0f && text_begin < text_end && text_end - text_begin <= IM_FONT_LAYOUT_CACHE_MAX_TEXT_LEN)
+    {
+        ImFontLayoutCacheEntry* cache_entry = LayoutCache->GetOrAdd(text_begin, text_end, size, FLT_MAX, wrap_width);
+        if (!cache_entry->HasQuads)
+        {
+            ImFontLayoutTextQuads(this, size, wrap_width, text_begin, text_end, &cache_entry->Quads);
+            cache_entry->HasQuads = true;
+        }
+        ImFontRenderLayoutQuads(draw_list, ImVec2(x, y), col, clip_rect, cache_entry->Quads.Data, cache_entry->Quads.Size, cpu_fine_clip);
+        return;
+    }
+
     const float start_x = x;
     const float scale = size / FontSize;
     const float line_height = FontSize * scale;
@@ -59,6 +59,12 @@ Index of this file:
 #include <immintrin.h>
 #endif
 
+// Enable NEON intrinsics if available (AArch64 only: the vector paths rely on vdivq_f32/vsqrtq_f32 to match scalar results)
+#if !defined(IMGUI_ENABLE_SSE) && defined(__ARM_NEON) && defined(__aarch64__) && !defined(IMGUI_DISABLE_NEON)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -3732,6 +3738,60 @@ namespace ImGui
 // [SECTION] ImFontAtlas internal API
 //-----------------------------------------------------------------------------
 
+// Longest string (in bytes) stored by ImFontLayoutCache, longer strings are always measured/rendered directly.
+#ifndef IM_FONT_LAYOUT_CACHE_MAX_TEXT_LEN
+#define IM_FONT_LAYOUT_CACHE_MAX_TEXT_LEN   256
+#endif
+
+// Glyph quad laid out by ImFont::RenderText(), relative to the (truncated) text position
+struct ImFontLayoutQuad
+{
+    float           X0, Y0, X1, Y1;
+    float           U0, V0, U1, V1;
+    bool            Colored;
+};
+
+// Storage for ImFontLayoutCache
+struct ImFontLayoutCacheEntry
+{
+    ImGuiID         Key;                // Hash of text and parameters, 0 when unused
+    float           Size;
+    float           MaxWidth;
+    float           WrapWidth;
+    ImVector<char>  Text;               // Copy of the text to resolve hash collisions
+    ImVec2          TextSize;           // CalcTextSizeA() output
+    int             RemainingOffset;    // CalcTextSizeA() 'remaining' output, relative to the start of the text
+    bool            HasTextSize;
+    bool            HasQuads;
+    ImVector<ImFontLayoutQuad> Quads;   // RenderText() output, ignoring clipping
+    int             LruPrev, LruNext;   // Index of more/less recently used entries, -1 at either end
+
+    ImFontLayoutCacheEntry()            { Key = 0; Size = MaxWidth = WrapWidth = 0.0f; RemainingOffset = 0; HasTextSize = HasQuads = false; LruPrev = LruNext = -1; }
+};
+
+// Per-font cache of text layouts (see ImFont::SetLayoutCacheCapacity())
+// - Open-addressing hash table (Buckets) over a fixed pool of entries, least recently used entry is recycled when full.
+struct IMGUI_API ImFontLayoutCache
+{
+    ImVector<ImFontLayoutCacheEntry> Entries;
+    ImVector<int>   Buckets;            // Index into Entries, -1 when empty. Size is a power of two.
+    int             EntriesUsed;
+    int             LruHead, LruTail;   // Most/least recently used entry
+    int             MetricsHits;
+    int             MetricsMisses;
+
+    ImFontLayoutCache()                 { EntriesUsed = 0; LruHead = LruTail = -1; MetricsHits = MetricsMisses = 0; }
+    ~ImFontLayoutCache()                { Entries.clear_destruct(); }
+    void            SetCapacity(int capacity);
+    void            Clear();
+    ImFontLayoutCacheEntry* GetOrAdd(const char* text_begin, const char* text_end, float size, float max_width, float wrap_width);
+
+    // [Internal]
+    void            _LruUnlink(int entry_idx);
+    void            _LruPushFront(int entry_idx);
+    void            _RemoveBucket(int bucket_idx);
+};
+
 // This structure is likely to evolve as we add support for incremental atlas updates
 struct ImFontBuilderIO
 {
@@ -15,6 +15,7 @@ Index of this file:
 // [SECTION] Widgets: SliderScalar, SliderFloat, SliderInt, etc.
 // [SECTION] Widgets: InputScalar, InputFloat, InputInt, etc.
 // [SECTION] Widgets: InputText, InputTextMultiline
+// [SECTION] Widgets: InputTextMultilineLarge
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 // [SECTION] Widgets: TreeNode, CollapsingHeader, etc.
 // [SECTION] Widgets: Selectable
@@ -5078,6 +5079,612 @@ void ImGui::DebugNodeInputTextState(ImGuiInputTextState* state)
 #endif
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Widgets: InputTextMultilineLarge
+//-------------------------------------------------------------------------
+// - InputTextLargePrevChar() [Internal]
+// - InputTextLargeNextChar() [Internal]
+// - InputTextLargeIsWordBoundary() [Internal]
+// - InputTextLargeCalcOffsetX() [Internal]
+// - InputTextLargeLocateX() [Internal]
+// - InputTextLargeReplaceSelection() [Internal]
+// - InputTextMultilineLarge()
+//-------------------------------------------------------------------------
+// Unlike InputTextEx() which converts the whole buffer to wide chars on activation and scans all of it every frame,
+// this works on an ImGuiLargeText in place: only the visible lines are read and measured, and edits go through the piece table.
+//-------------------------------------------------------------------------
+
+static int InputTextLargePrevChar(const ImGuiLargeText* text, int offset)
+{
+    if (offset <= 0)
+        return 0;
+    offset--;
+    while (offset > 0 && (text->GetChar(offset) & 0xC0) == 0x80)
+        offset--;
+    return offset;
+}
+
+static int InputTextLargeNextChar(const ImGuiLargeText* text, int offset)
+{
+    const int len = text->GetLength();
+    if (offset >= len)
+        return len;
+    offset++;
+    while (offset < len && (text->GetChar(offset) & 0xC0) == 0x80)
+        offset++;
+    return offset;
+}
+
+// Same rules as is_word_boundary_from_right()/is_word_boundary_from_left(), non-ASCII characters are treated as word characters
+static bool InputTextLargeIsWordBoundary(const ImGuiLargeText* text, int offset, bool from_right)
+{
+    if (offset <= 0 || offset >= text->GetLength())
+        return true;
+    const unsigned int c_before = (unsigned char)text->GetChar(offset - 1);
+    const unsigned int c_after = (unsigned char)text->GetChar(offset);
+    const unsigned int c_prev = from_right ? c_before : c_after;
+    const unsigned int c_curr = from_right ? c_after : c_before;
+    const bool prev_white = ImCharIsBlankW(c_prev);
+    const bool prev_separ = ImStb::is_separator(c_prev);
+    const bool curr_white = ImCharIsBlankW(c_curr);
+    const bool curr_separ = ImStb::is_separator(c_curr);
+    if (from_right)
+        return ((prev_white || prev_separ) && !(curr_separ || curr_white)) || (curr_separ && !prev_separ);
+    return (prev_white && !(curr_separ || curr_white)) || (curr_separ && !prev_separ);
+}
+
+static float InputTextLargeCalcOffsetX(ImGuiContext* ctx, ImGuiLargeText* text, int line, int offset)
+{
+    const char* line_end;
+    const char* line_begin = text->GetLine(line, &line_end);
+    const int len = ImMin(offset - text->GetLineStart(line), (int)(line_end - line_begin));
+    return ctx->Font->CalcTextSizeA(ctx->FontSize, FLT_MAX, 0.0f, line_begin, line_begin + len).x;
+}
+
+// Return the offset of the character boundary closest to 'x' on a line
+static int InputTextLargeLocateX(ImGuiContext* ctx, ImGuiLargeText* text, int line, float x)
+{
+    const char* line_end;
+    const char* line_begin = text->GetLine(line, &line_end);
+    const int line_start = text->GetLineStart(line);
+    ImFont* font = ctx->Font;
+    const float scale = ctx->FontSize / font->FontSize;
+    float line_x = 0.0f;
+    for (const char* s = line_begin; s < line_end; )
+    {
+        unsigned int c = (unsigned int)(unsigned char)*s;
+        int char_len = 1;
+        if (c >= 0x80)
+            char_len = ImMax(ImTextCharFromUtf8(&c, s, line_end), 1);
+        const float advance = (c == '\r') ? 0.0f : font->GetCharAdvance((ImWchar)c) * scale;
+        if (x < line_x + advance * 0.5f)
+            return line_start + (int)(s - line_begin);
+        line_x += advance;
+        s += char_len;
+    }
+    return line_start + (int)(line_end - line_begin);
+}
+
+static void InputTextLargeReplaceSelection(ImGuiLargeText* text, const char* s, const char* s_end, bool record_undo)
+{
+    if (!s_end)
+        s_end = s + strlen(s);
+    if (text->HasSelection())
+    {
+        const int select_start = text->GetSelectionStart();
+        text->Erase(select_start, text->GetSelectionEnd() - select_start, record_undo);
+        text->Cursor = text->SelectAnchor = select_start;
+    }
+    text->Insert(text->Cursor, s, s_end, record_undo);
+    text->Cursor = text->SelectAnchor = text->Cursor + (int)(s_end - s);
+    text->PreferredX = -1.0f;
+    text->CursorFollow = true;
+}
+
+bool ImGui::InputTextMultilineLarge(const char* label, ImGuiLargeText* text, const ImVec2& size_arg, ImGuiInputTextFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    IM_ASSERT(text != NULL);
+    IM_ASSERT(!(flags & (ImGuiInputTextFlags_Password | ImGuiInputTextFlags_CallbackResize | ImGuiInputTextFlags_CallbackHistory | ImGuiInputTextFlags_CallbackCompletion))); // Unsupported
+
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    const ImGuiStyle& style = g.Style;
+
+    const bool is_readonly = (flags & ImGuiInputTextFlags_ReadOnly) != 0;
+    const bool is_undoable = (flags & ImGuiInputTextFlags_NoUndoRedo) == 0;
+    const bool is_osx = io.ConfigMacOSXBehaviors;
+    const ImGuiInputTextFlags filter_flags = (flags | ImGuiInputTextFlags_Multiline) & ~ImGuiInputTextFlags_CallbackCharFilter;
+    const bool is_filtered = (flags & (ImGuiInputTextFlags_CharsDecimal | ImGuiInputTextFlags_CharsHexadecimal | ImGuiInputTextFlags_CharsUppercase | ImGuiInputTextFlags_CharsNoBlank | ImGuiInputTextFlags_CharsScientific)) != 0;
+
+    BeginGroup(); // Open group before calling GetID() because groups tracks id created within their scope (including the scrollbar)
+    const ImGuiID id = window->GetID(label);
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), g.FontSize * 8.0f + style.FramePadding.y * 2.0f);
+    const ImVec2 total_size = ImVec2(frame_size.x + (label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f), frame_size.y);
+
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Min + total_size);
+
+    ImVec2 backup_pos = window->DC.CursorPos;
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, id, &frame_bb, ImGuiItemFlags_Inputable))
+    {
+        EndGroup();
+        return false;
+    }
+    const ImGuiItemStatusFlags item_status_flags = g.LastItemData.StatusFlags;
+    ImGuiLastItemData item_data_backup = g.LastItemData;
+    window->DC.CursorPos = backup_pos;
+
+    // Prevent NavActivate reactivating in BeginChild().
+    const ImGuiID backup_activate_id = g.NavActivateId;
+    if (g.ActiveId == id) // Prevent reactivation
+        g.NavActivateId = 0;
+
+    PushStyleColor(ImGuiCol_ChildBg, style.Colors[ImGuiCol_FrameBg]);
+    PushStyleVar(ImGuiStyleVar_ChildRounding, style.FrameRounding);
+    PushStyleVar(ImGuiStyleVar_ChildBorderSize, style.FrameBorderSize);
+    PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0)); // Ensure no clip rect so mouse hover can reach FramePadding edges
+    bool child_visible = BeginChildEx(label, id, frame_bb.GetSize(), true, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_HorizontalScrollbar);
+    g.NavActivateId = backup_activate_id;
+    PopStyleVar(3);
+    PopStyleColor();
+    if (!child_visible)
+    {
+        EndChild();
+        EndGroup();
+        return false;
+    }
+    ImGuiWindow* draw_window = g.CurrentWindow; // Child window
+    draw_window->DC.NavLayersActiveMaskNext |= (1 << draw_window->DC.NavLayerCurrent); // This is to ensure that EndChild() will display a navigation highlight so we can "enter" into it.
+    draw_window->DC.CursorPos += style.FramePadding;
+    const ImVec2 inner_size = frame_size - draw_window->ScrollbarSizes;
+
+    const bool hovered = ItemHoverable(frame_bb, id, g.LastItemData.InFlags);
+    if (hovered)
+        g.MouseCursor = ImGuiMouseCursor_TextInput;
+
+    const bool input_requested_by_tabbing = (item_status_flags & ImGuiItemStatusFlags_FocusedByTabbing) != 0;
+    const bool input_requested_by_nav = (g.ActiveId != id) && ((g.NavActivateId == id) && ((g.NavActivateFlags & ImGuiActivateFlags_PreferInput) || (g.NavInputSource == ImGuiInputSource_Keyboard)));
+    const bool user_clicked = hovered && io.MouseClicked[0];
+    const bool init_make_active = (user_clicked || input_requested_by_nav || input_requested_by_tabbing);
+    bool clear_active_id = false;
+    bool value_changed = false;
+
+    if (g.ActiveId != id && init_make_active)
+    {
+        SetActiveID(id, window);
+        SetFocusID(id, window);
+        FocusWindow(window);
+        text->CursorAnim = -0.30f; // See ImGuiInputTextState::CursorAnimReset()
+    }
+    if (g.ActiveId == id)
+    {
+        // Declare some inputs, the other are registered and polled via Shortcut() routing system.
+        if (user_clicked)
+            SetKeyOwner(ImGuiKey_MouseLeft, id);
+        g.ActiveIdUsingNavDirMask |= (1 << ImGuiDir_Left) | (1 << ImGuiDir_Right) | (1 << ImGuiDir_Up) | (1 << ImGuiDir_Down);
+        SetKeyOwner(ImGuiKey_Home, id);
+        SetKeyOwner(ImGuiKey_End, id);
+        SetKeyOwner(ImGuiKey_PageUp, id);
+        SetKeyOwner(ImGuiKey_PageDown, id);
+        if (is_osx)
+            SetKeyOwner(ImGuiMod_Alt, id);
+        if (flags & ImGuiInputTextFlags_AllowTabInput) // Disable keyboard tabbing out as we will use the \t character.
+            SetShortcutRouting(ImGuiKey_Tab, id);
+    }
+
+    // Release focus when we click outside
+    if (g.ActiveId == id && io.MouseClicked[0] && !init_make_active)
+        clear_active_id = true;
+
+    // The text may have been modified while we were not active
+    const int text_len = text->GetLength();
+    text->Cursor = ImClamp(text->Cursor, 0, text_len);
+    text->SelectAnchor = ImClamp(text->SelectAnchor, 0, text_len);
+
+    const float line_height = g.FontSize;
+    ImVec2 text_origin = draw_window->DC.CursorPos;
+
+    // Process mouse inputs and character inputs
+    if (g.ActiveId == id)
+    {
+        // Although we are active we don't prevent mouse from hovering other elements unless we are interacting right now with the widget.
+        g.ActiveIdAllowOverlap = !io.MouseDown[0];
+
+        const ImVec2 mouse_pos = io.MousePos - text_origin;
+        const int mouse_line = ImClamp((int)ImFloor(mouse_pos.y / line_height), 0, text->GetLineCount() - 1);
+        if (hovered && io.MouseClickedCount[0] >= 2 && !io.KeyShift)
+        {
+            const int mouse_offset = InputTextLargeLocateX(&g, text, mouse_line, mouse_pos.x);
+            if (((io.MouseClickedCount[0] - 2) % 2) == 0)
+            {
+                // Double-click: Select word
+                int word_start = mouse_offset;
+                while (word_start > 0 && !InputTextLargeIsWordBoundary(text, word_start, true))
+                    word_start--;
+                int word_end = mouse_offset;
+                while (word_end < text->GetLength() && !InputTextLargeIsWordBoundary(text, word_end, false))
+                    word_end++;
+                text->SelectAnchor = word_start;
+                text->Cursor = word_end;
+            }
+            else
+            {
+                // Triple-click: Select line
+                text->SelectAnchor = text->GetLineStart(mouse_line);
+                text->Cursor = ImMin(text->GetLineEnd(mouse_line) + 1, text->GetLength());
+            }
+            text->PreferredX = -1.0f;
+            text->CursorAnim = -0.30f;
+        }
+        else if (io.MouseClicked[0])
+        {
+            if (hovered)
+            {
+                text->Cursor = InputTextLargeLocateX(&g, text, mouse_line, mouse_pos.x);
+                if (!io.KeyShift)
+                    text->SelectAnchor = text->Cursor;
+                text->PreferredX = -1.0f;
+                text->CursorAnim = -0.30f;
+            }
+        }
+        else if (io.MouseDown[0] && (io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f))
+        {
+            text->Cursor = InputTextLargeLocateX(&g, text, mouse_line, mouse_pos.x);
+            text->PreferredX = -1.0f;
+            text->CursorAnim = -0.30f;
+            text->CursorFollow = true;
+        }
+
+        // We expect backends to emit a Tab key but some also emit a Tab character which we ignore (#2467, #1336)
+        if ((flags & ImGuiInputTextFlags_AllowTabInput) && Shortcut(ImGuiKey_Tab, id) && !is_readonly)
+        {
+            unsigned int c = '\t'; // Insert TAB
+            if (InputTextFilterCharacter(&g, &c, filter_flags, NULL, NULL, ImGuiInputSource_Keyboard))
+            {
+                char c_utf8[5];
+                ImTextCharToUtf8(c_utf8, c);
+                InputTextLargeReplaceSelection(text, c_utf8, c_utf8 + strlen(c_utf8), is_undoable);
+                value_changed = true;
+            }
+        }
+
+        // Process regular text input, all characters of the frame are inserted at once.
+        // We ignore CTRL inputs, but need to allow ALT+CTRL as some keyboards (e.g. German) use AltGR (which _is_ Alt+Ctrl) to input certain characters.
+        const bool ignore_char_inputs = (io.KeyCtrl && !io.KeyAlt) || (is_osx && io.KeySuper);
+        if (io.InputQueueCharacters.Size > 0)
+        {
+            if (!ignore_char_inputs && !is_readonly && !input_requested_by_nav)
+            {
+                // Inserted every time the buffer fills up, so the whole queue is inserted before being consumed
+                char typed[64 * 4];
+                int typed_len = 0;
+                for (int n = 0; n < io.InputQueueCharacters.Size; n++)
+                {
+                    // Insert character if they pass filtering
+                    unsigned int c = (unsigned int)io.InputQueueCharacters[n];
+                    if (c == '\t') // Skip Tab, see above.
+                        continue;
+                    if (InputTextFilterCharacter(&g, &c, filter_flags, NULL, NULL, ImGuiInputSource_Keyboard))
+                    {
+                        if (typed_len + 4 > IM_ARRAYSIZE(typed))
+                        {
+                            InputTextLargeReplaceSelection(text, typed, typed + typed_len, is_undoable);
+                            value_changed = true;
+                            typed_len = 0;
+                        }
+                        char c_utf8[5];
+                        ImTextCharToUtf8(c_utf8, c);
+                        for (const char* p = c_utf8; *p; p++)
+                            typed[typed_len++] = *p;
+                    }
+                }
+                if (typed_len > 0)
+                {
+                    InputTextLargeReplaceSelection(text, typed, typed + typed_len, is_undoable);
+                    value_changed = true;
+                }
+            }
+
+            // Consume characters
+            io.InputQueueCharacters.resize(0);
+        }
+    }
+
+    // Process other shortcuts/key-presses
+    if (g.ActiveId == id && !g.ActiveIdIsJustActivated && !clear_active_id)
+    {
+        const int row_count_per_page = ImMax((int)((inner_size.y - style.FramePadding.y) / line_height), 1);
+        const bool is_wordmove_key_down = is_osx ? io.KeyAlt : io.KeyCtrl;                     // OS X style: Text editing cursor movement using Alt instead of Ctrl
+        const bool is_startend_key_down = is_osx && io.KeySuper && !io.KeyCtrl && !io.KeyAlt;  // OS X style: Line/Text Start and End using Cmd+Arrows instead of Home/End
+
+        const ImGuiInputFlags f_repeat = ImGuiInputFlags_Repeat;
+        const bool is_cut   = (Shortcut(ImGuiMod_Shortcut | ImGuiKey_X, id, f_repeat) || Shortcut(ImGuiMod_Shift | ImGuiKey_Delete, id, f_repeat)) && !is_readonly && text->HasSelection();
+        const bool is_copy  = (Shortcut(ImGuiMod_Shortcut | ImGuiKey_C, id) || Shortcut(ImGuiMod_Ctrl | ImGuiKey_Insert, id)) && text->HasSelection();
+        const bool is_paste = (Shortcut(ImGuiMod_Shortcut | ImGuiKey_V, id, f_repeat) || Shortcut(ImGuiMod_Shift | ImGuiKey_Insert, id, f_repeat)) && !is_readonly;
+        const bool is_undo  = (Shortcut(ImGuiMod_Shortcut | ImGuiKey_Z, id, f_repeat)) && !is_readonly && is_undoable;
+        const bool is_redo  = (Shortcut(ImGuiMod_Shortcut | ImGuiKey_Y, id, f_repeat) || (is_osx && Shortcut(ImGuiMod_Shortcut | ImGuiMod_Shift | ImGuiKey_Z, id, f_repeat))) && !is_readonly && is_undoable;
+        const bool is_select_all = Shortcut(ImGuiMod_Shortcut | ImGuiKey_A, id);
+        const bool is_enter_pressed = IsKeyPressed(ImGuiKey_Enter, true) || IsKeyPressed(ImGuiKey_KeypadEnter, true);
+        const bool is_cancel = Shortcut(ImGuiKey_Escape, id, f_repeat);
+        const bool is_delete = IsKeyPressed(ImGuiKey_Delete) && !is_readonly && !is_cut;
+        const bool is_backspace = !is_delete && IsKeyPressed(ImGuiKey_Backspace) && !is_readonly;
+
+        const int cursor_line = text->GetLineFromOffset(text->Cursor);
+        int new_cursor = -1;
+        int move_lines = 0;
+        if (IsKeyPressed(ImGuiKey_LeftArrow))
+        {
+            if (is_startend_key_down)               new_cursor = text->GetLineStart(cursor_line);
+            else if (is_wordmove_key_down)          { new_cursor = InputTextLargePrevChar(text, text->Cursor); while (new_cursor > 0 && !InputTextLargeIsWordBoundary(text, new_cursor, true)) new_cursor--; }
+            else if (text->HasSelection() && !io.KeyShift) new_cursor = text->GetSelectionStart();
+            else                                    new_cursor = InputTextLargePrevChar(text, text->Cursor);
+        }
+        else if (IsKeyPressed(ImGuiKey_RightArrow))
+        {
+            if (is_startend_key_down)               new_cursor = text->GetLineEnd(cursor_line);
+            else if (is_wordmove_key_down)          { new_cursor = InputTextLargeNextChar(text, text->Cursor); while (new_cursor < text->GetLength() && !InputTextLargeIsWordBoundary(text, new_cursor, true)) new_cursor++; }
+            else if (text->HasSelection() && !io.KeyShift) new_cursor = text->GetSelectionEnd();
+            else                                    new_cursor = InputTextLargeNextChar(text, text->Cursor);
+        }
+        else if (IsKeyPressed(ImGuiKey_UpArrow))    { if (io.KeyCtrl) SetScrollY(draw_window, ImMax(draw_window->Scroll.y - line_height, 0.0f)); else if (is_startend_key_down) new_cursor = 0; else move_lines = -1; }
+        else if (IsKeyPressed(ImGuiKey_DownArrow))  { if (io.KeyCtrl) SetScrollY(draw_window, ImMin(draw_window->Scroll.y + line_height, GetScrollMaxY())); else if (is_startend_key_down) new_cursor = text->GetLength(); else move_lines = +1; }
+        else if (IsKeyPressed(ImGuiKey_PageUp))     { move_lines = -row_count_per_page; }
+        else if (IsKeyPressed(ImGuiKey_PageDown))   { move_lines = +row_count_per_page; }
+        else if (IsKeyPressed(ImGuiKey_Home))       { new_cursor = io.KeyCtrl ? 0 : text->GetLineStart(cursor_line); }
+        else if (IsKeyPressed(ImGuiKey_End))        { new_cursor = io.KeyCtrl ? text->GetLength() : text->GetLineEnd(cursor_line); }
+        else if (is_delete || is_backspace)
+        {
+            if (!text->HasSelection())
+            {
+                if (is_backspace && is_wordmove_key_down)
+                    { text->SelectAnchor = InputTextLargePrevChar(text, text->Cursor); while (text->SelectAnchor > 0 && !InputTextLargeIsWordBoundary(text, text->SelectAnchor, true)) text->SelectAnchor--; }
+                else if (is_backspace && is_osx && io.KeySuper && !io.KeyAlt && !io.KeyCtrl)
+                    text->SelectAnchor = text->GetLineStart(cursor_line);
+                else if (is_backspace)
+                    text->SelectAnchor = InputTextLargePrevChar(text, text->Cursor);
+                else if (is_wordmove_key_down)
+                    { text->SelectAnchor = InputTextLargeNextChar(text, text->Cursor); while (text->SelectAnchor < text->GetLength() && !InputTextLargeIsWordBoundary(text, text->SelectAnchor, true)) text->SelectAnchor++; }
+                else
+                    text->SelectAnchor = InputTextLargeNextChar(text, text->Cursor);
+            }
+            if (text->HasSelection())
+            {
+                InputTextLargeReplaceSelection(text, "", NULL, is_undoable);
+                value_changed = true;
+            }
+        }
+        else if (is_enter_pressed)
+        {
+            // Determine if we turn Enter into a \n character
+            const bool ctrl_enter_for_new_line = (flags & ImGuiInputTextFlags_CtrlEnterForNewLine) != 0;
+            if ((ctrl_enter_for_new_line && !io.KeyCtrl) || (!ctrl_enter_for_new_line && io.KeyCtrl))
+            {
+                clear_active_id = true;
+            }
+            else if (!is_readonly)
+            {
+                unsigned int c = '\n'; // Insert new line
+                if (InputTextFilterCharacter(&g, &c, filter_flags, NULL, NULL, ImGuiInputSource_Keyboard))
+                {
+                    InputTextLargeReplaceSelection(text, "\n", NULL, is_undoable);
+                    value_changed = true;
+                }
+            }
+        }
+        else if (is_cancel)
+        {
+            // Edits are applied in place so there is nothing to revert, use Undo()
+            clear_active_id = true;
+        }
+        else if (is_undo || is_redo)
+        {
+            if (is_undo ? text->Undo() : text->Redo())
+            {
+                text->PreferredX = -1.0f;
+                text->CursorFollow = true;
+                value_changed = true;
+            }
+        }
+        else if (is_select_all)
+        {
+            text->SelectAnchor = 0;
+            text->Cursor = text->GetLength();
+            text->CursorFollow = true;
+        }
+        else if (is_cut || is_copy)
+        {
+            // Cut, Copy
+            if (io.SetClipboardTextFn)
+            {
+                ImVector<char> clipboard_data;
+                text->GetText(text->GetSelectionStart(), text->GetSelectionEnd(), &clipboard_data);
+                SetClipboardText(clipboard_data.Data);
+            }
+            if (is_cut)
+            {
+                InputTextLargeReplaceSelection(text, "", NULL, is_undoable);
+                value_changed = true;
+            }
+        }
+        else if (is_paste)
+        {
+            if (const char* clipboard = GetClipboardText())
+            {
+                // Filter pasted text only when character filters are used, so that pasting MBs of text stays a single copy
+                ImVector<char> filtered;
+                const char* paste_begin = clipboard;
+                const char* paste_end = clipboard + strlen(clipboard);
+                if (is_filtered)
+                {
+                    filtered.reserve((int)(paste_end - paste_begin));
+                    for (const char* s = paste_begin; s < paste_end; )
+                    {
+                        unsigned int c;
+                        s += ImMax(ImTextCharFromUtf8(&c, s, paste_end), 1);
+                        if (!InputTextFilterCharacter(&g, &c, filter_flags, NULL, NULL, ImGuiInputSource_Clipboard))
+                            continue;
+                        char c_utf8[5];
+                        ImTextCharToUtf8(c_utf8, c);
+                        for (const char* p = c_utf8; *p; p++)
+                            filtered.push_back(*p);
+                    }
+                    paste_begin = filtered.Data;
+                    paste_end = filtered.Data + filtered.Size;
+                }
+                if (paste_begin != paste_end)
+                {
+                    InputTextLargeReplaceSelection(text, paste_begin, paste_end, is_undoable);
+                    value_changed = true;
+                }
+            }
+        }
+
+        // Move cursor, up/down movements keep the horizontal position of where they started
+        if (move_lines != 0)
+        {
+            if (text->PreferredX < 0.0f)
+                text->PreferredX = InputTextLargeCalcOffsetX(&g, text, cursor_line, text->Cursor);
+            const int target_line = cursor_line + move_lines;
+            if (target_line < 0)
+                new_cursor = 0;
+            else if (target_line >= text->GetLineCount())
+                new_cursor = text->GetLength();
+            else
+                new_cursor = InputTextLargeLocateX(&g, text, target_line, text->PreferredX);
+        }
+        if (new_cursor >= 0)
+        {
+            const float preferred_x = text->PreferredX;
+            text->Cursor = new_cursor;
+            if (!io.KeyShift)
+                text->SelectAnchor = new_cursor;
+            text->PreferredX = (move_lines != 0) ? preferred_x : -1.0f;
+            text->CursorAnim = -0.30f;
+            text->CursorFollow = true;
+        }
+    }
+
+    // Release active ID at the end of the function (so e.g. pressing Return still does a final application of the value)
+    // Otherwise request text input ahead for next frame.
+    const bool render_cursor = (g.ActiveId == id) && !clear_active_id;
+    if (g.ActiveId == id && clear_active_id)
+        ClearActiveID();
+    else if (g.ActiveId == id)
+        g.WantTextInputNextFrame = 1;
+
+    const int line_count = text->GetLineCount();
+    const float text_height = line_count * line_height;
+    const int cursor_line = text->GetLineFromOffset(text->Cursor);
+    const float cursor_x = render_cursor ? InputTextLargeCalcOffsetX(&g, text, cursor_line, text->Cursor) : 0.0f;
+
+    // Scroll
+    if (render_cursor && text->CursorFollow)
+    {
+        const float visible_width = inner_size.x - style.FramePadding.x * 2.0f;
+        const float visible_height = inner_size.y - style.FramePadding.y * 2.0f;
+        const float cursor_y = cursor_line * line_height;
+        ImVec2 scroll = draw_window->Scroll;
+        if (cursor_x < scroll.x)
+            scroll.x = IM_TRUNC(ImMax(0.0f, cursor_x - visible_width * 0.25f));
+        else if (cursor_x - visible_width >= scroll.x)
+            scroll.x = IM_TRUNC(cursor_x - visible_width * 0.75f);
+        if (cursor_y < scroll.y)
+            scroll.y = cursor_y;
+        else if (cursor_y + line_height - visible_height >= scroll.y)
+            scroll.y = cursor_y + line_height - visible_height;
+        scroll.y = ImClamp(scroll.y, 0.0f, ImMax((text_height + style.FramePadding.y * 2.0f) - inner_size.y, 0.0f));
+        text->MaxLineWidth = ImMax(text->MaxLineWidth, cursor_x);
+        text_origin += draw_window->Scroll - scroll;   // Manipulate cursor pos immediately avoid a frame of lag
+        draw_window->Scroll = scroll;
+        text->CursorFollow = false;
+    }
+
+    // Render visible lines only
+    ImDrawList* draw_list = draw_window->DrawList;
+    const ImRect clip_rect = draw_window->ClipRect;
+    const int line_first = ImClamp((int)ImFloor((clip_rect.Min.y - text_origin.y) / line_height), 0, line_count);
+    const int line_last = ImClamp((int)ImFloor((clip_rect.Max.y - text_origin.y) / line_height) + 1, line_first, line_count);
+    const bool render_selection = render_cursor && text->HasSelection();
+    const int select_start = text->GetSelectionStart();
+    const int select_end = text->GetSelectionEnd();
+    const ImU32 text_col = GetColorU32(ImGuiCol_Text);
+    const ImU32 select_col = GetColorU32(ImGuiCol_TextSelectedBg);
+    for (int line = line_first; line < line_last; line++)
+    {
+        const char* line_end;
+        const char* line_begin = text->GetLine(line, &line_end);
+        const int line_start = text->GetLineStart(line);
+        const ImVec2 line_pos(text_origin.x, text_origin.y + line * line_height);
+        const float line_width = g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, 0.0f, line_begin, line_end).x;
+        text->MaxLineWidth = ImMax(text->MaxLineWidth, line_width);
+
+        // Draw selection, including the new line character
+        const int line_end_offset = line_start + (int)(line_end - line_begin);
+        if (render_selection && select_start <= line_end_offset && select_end > line_start)
+        {
+            const float x0 = (select_start > line_start) ? g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, 0.0f, line_begin, line_begin + (select_start - line_start)).x : 0.0f;
+            float x1 = (select_end <= line_end_offset) ? g.Font->CalcTextSizeA(g.FontSize, FLT_MAX, 0.0f, line_begin, line_begin + (select_end - line_start)).x : line_width;
+            if (select_end > line_end_offset)
+                x1 += IM_TRUNC(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected empty lines
+            draw_list->AddRectFilled(ImVec2(line_pos.x + x0, line_pos.y), ImVec2(line_pos.x + x1, line_pos.y + line_height), select_col);
+        }
+
+        if (line_begin != line_end)
+            draw_list->AddText(g.Font, g.FontSize, line_pos, text_col, line_begin, line_end);
+    }
+
+    // Draw blinking cursor
+    if (render_cursor)
+    {
+        text->CursorAnim += io.DeltaTime;
+        bool cursor_is_visible = (!g.IO.ConfigInputTextCursorBlink) || (text->CursorAnim <= 0.0f) || ImFmod(text->CursorAnim, 1.20f) <= 0.80f;
+        ImVec2 cursor_screen_pos = ImTrunc(text_origin + ImVec2(cursor_x, (cursor_line + 1) * line_height));
+        ImRect cursor_screen_rect(cursor_screen_pos.x, cursor_screen_pos.y - g.FontSize + 0.5f, cursor_screen_pos.x + 1.0f, cursor_screen_pos.y - 1.5f);
+        if (cursor_is_visible && cursor_screen_rect.Overlaps(clip_rect))
+            draw_list->AddLine(cursor_screen_rect.Min, cursor_screen_rect.GetBL(), text_col);
+
+        // Notify OS of text input position for advanced IME (-1 x offset so that Windows IME can cover our cursor. Bit of an extra nicety.)
+        if (!is_readonly)
+        {
+            g.PlatformImeData.WantVisible = true;
+            g.PlatformImeData.InputPos = ImVec2(cursor_screen_pos.x - 1.0f, cursor_screen_pos.y - g.FontSize);
+            g.PlatformImeData.InputLineHeight = g.FontSize;
+            g.PlatformImeViewport = window->Viewport->ID;
+        }
+    }
+
+    // Lines are only measured when displayed, so the horizontal scrolling range grows as wider lines get scrolled into view.
+    // For focus requests to work on our multiline we need to ensure our child ItemAdd() call specifies the ImGuiItemFlags_Inputable (ref issue #4761)...
+    Dummy(ImVec2(text->MaxLineWidth + style.FramePadding.x, text_height + style.FramePadding.y));
+    g.NextItemData.ItemFlags |= ImGuiItemFlags_Inputable | ImGuiItemFlags_NoTabStop;
+    EndChild();
+    item_data_backup.StatusFlags |= (g.LastItemData.StatusFlags & ImGuiItemStatusFlags_HoveredWindow);
+
+    // ...and then we need to undo the group overriding last item data, see InputTextEx()
+    EndGroup();
+    if (g.LastItemData.ID == 0)
+    {
+        g.LastItemData.ID = id;
+        g.LastItemData.InFlags = item_data_backup.InFlags;
+        g.LastItemData.StatusFlags = item_data_backup.StatusFlags;
+    }
+
+    if (label_size.x > 0)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, frame_bb.Min.y + style.FramePadding.y), label);
+
+    if (value_changed && !(flags & ImGuiInputTextFlags_NoMarkEdited))
+        MarkItemEdited(id);
+
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Inputable);
+    return value_changed;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 //-------------------------------------------------------------------------
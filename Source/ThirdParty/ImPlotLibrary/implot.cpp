@@ -206,6 +206,278 @@ ImPlotStyle::ImPlotStyle() {
     UseISO8601       = false;
 }
 
+static inline void ExtendSeriesNode(ImPlotSeries::Node& node, int idx, double y) {
+    if (ImNan(y))
+        return;
+    if (node.IdxMin < 0 || y < node.YMin) { node.YMin = y; node.IdxMin = idx; }
+    if (node.IdxMax < 0 || y > node.YMax) { node.YMax = y; node.IdxMax = idx; }
+}
+
+static inline void MergeSeriesNode(ImPlotSeries::Node& node, const ImPlotSeries::Node& other) {
+    if (other.IdxMin >= 0 && (node.IdxMin < 0 || other.YMin < node.YMin)) { node.YMin = other.YMin; node.IdxMin = other.IdxMin; }
+    if (other.IdxMax >= 0 && (node.IdxMax < 0 || other.YMax > node.YMax)) { node.YMax = other.YMax; node.IdxMax = other.IdxMax; }
+}
+
+ImPlotSeries::ImPlotSeries() {
+    Clear();
+}
+
+void ImPlotSeries::SetData(const double* ys, int count, double xscale, double xstart) {
+    Clear();
+    XScale = xscale;
+    XStart = xstart;
+    XMonotonic = xscale >= 0 && !ImNanOrInf(xscale) && !ImNanOrInf(xstart);
+    Append(nullptr, ys, count);
+}
+
+void ImPlotSeries::SetData(const double* xs, const double* ys, int count) {
+    Clear();
+    Append(xs, ys, count);
+}
+
+void ImPlotSeries::Append(double y) {
+    Append(nullptr, &y, 1);
+}
+
+void ImPlotSeries::Append(double x, double y) {
+    Append(&x, &y, 1);
+}
+
+void ImPlotSeries::Append(const double* xs, const double* ys, int count) {
+    IM_ASSERT(count >= 0);
+    IM_ASSERT((xs == nullptr || Xs.Size == Ys.Size) && "Series has uniform x values");
+    IM_ASSERT((xs != nullptr || Xs.Size == 0) && "Series has explicit x values");
+    if (count <= 0)
+        return;
+    const int first = Ys.Size;
+    if (xs != nullptr) {
+        Xs.resize(first + count);
+        memcpy(Xs.Data + first, xs, count * sizeof(double));
+        double prev = first > 0 ? Xs.Data[first - 1] : -INFINITY;
+        for (int i = first; i < Xs.Size && XMonotonic; ++i) {
+            XMonotonic = !ImNanOrInf(Xs.Data[i]) && Xs.Data[i] >= prev;
+            prev = Xs.Data[i];
+        }
+    }
+    Ys.resize(first + count);
+    memcpy(Ys.Data + first, ys, count * sizeof(double));
+    _UpdateLevels(first);
+}
+
+void ImPlotSeries::Clear() {
+    Xs.clear();
+    Ys.clear();
+    XStart = 0;
+    XScale = 1;
+    XMonotonic = true;
+    for (int l = 0; l < IM_ARRAYSIZE(Levels); ++l)
+        Levels[l].clear();
+}
+
+static int SeriesBound(const ImPlotSeries& series, double x, bool upper) {
+    const int count = series.Size();
+    // for uniform x, guess the index and correct rounding errors, otherwise binary search
+    int lo = 0, hi = count;
+    if (series.Xs.Size == 0 && series.XScale > 0 && !ImNan(x)) {
+        const double guess = ImClamp((x - series.XStart) / series.XScale, -1.0, (double)count);
+        lo = ImClamp((int)ImFloor(guess) - 1, 0, count);
+        hi = ImClamp((int)ImFloor(guess) + 2, 0, count);
+        while (lo > 0 && (upper ? series.GetX(lo - 1) > x : series.GetX(lo - 1) >= x))
+            lo--;
+        while (hi < count && (upper ? series.GetX(hi) <= x : series.GetX(hi) < x))
+            hi++;
+    }
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        if (upper ? series.GetX(mid) <= x : series.GetX(mid) < x)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+int ImPlotSeries::LowerBound(double x) const {
+    IM_ASSERT(XMonotonic);
+    return SeriesBound(*this, x, false);
+}
+
+int ImPlotSeries::UpperBound(double x) const {
+    IM_ASSERT(XMonotonic);
+    return SeriesBound(*this, x, true);
+}
+
+bool ImPlotSeries::FindMinMax(int first, int last, int* idx_min, int* idx_max) const {
+    first = ImMax(first, 0);
+    last = ImMin(last, Ys.Size);
+    Node node;
+    node.YMin = node.YMax = 0;
+    node.IdxMin = node.IdxMax = -1;
+    // points of partially covered blocks are scanned, the blocks in between are queried from the top down
+    const int block_first = (first + 15) >> 4;
+    const int block_last = last >> 4;
+    if (block_first >= block_last) {
+        for (int i = first; i < last; ++i)
+            ExtendSeriesNode(node, i, Ys.Data[i]);
+    }
+    else {
+        for (int i = first; i < (block_first << 4); ++i)
+            ExtendSeriesNode(node, i, Ys.Data[i]);
+        for (int l = 0, lo = block_first, hi = block_last; lo < hi; ++l, lo >>= 1, hi >>= 1) {
+            if (lo & 1) MergeSeriesNode(node, Levels[l].Data[lo++]);
+            if (hi & 1) MergeSeriesNode(node, Levels[l].Data[--hi]);
+        }
+        for (int i = block_last << 4; i < last; ++i)
+            ExtendSeriesNode(node, i, Ys.Data[i]);
+    }
+    if (idx_min) *idx_min = node.IdxMin;
+    if (idx_max) *idx_max = node.IdxMax;
+    return node.IdxMin >= 0;
+}
+
+void ImPlotSeries::_UpdateLevels(int first) {
+    int lo = first >> 4;
+    Levels[0].resize((Ys.Size + 15) >> 4);
+    for (int i = lo; i < Levels[0].Size; ++i) {
+        Node& node = Levels[0].Data[i];
+        node.YMin = node.YMax = 0;
+        node.IdxMin = node.IdxMax = -1;
+        const int end = ImMin((i + 1) << 4, Ys.Size);
+        for (int j = i << 4; j < end; ++j)
+            ExtendSeriesNode(node, j, Ys.Data[j]);
+    }
+    for (int l = 1; l < IM_ARRAYSIZE(Levels); ++l) {
+        const ImVector<Node>& children = Levels[l - 1];
+        lo >>= 1;
+        Levels[l].resize(children.Size > 1 ? (children.Size + 1) >> 1 : 0);
+        for (int i = lo; i < Levels[l].Size; ++i) {
+            Node& node = Levels[l].Data[i];
+            node = children.Data[2 * i];
+            if (2 * i + 1 < children.Size)
+                MergeSeriesNode(node, children.Data[2 * i + 1]);
+        }
+    }
+}
+
+ImPlotStreamSeries::ImPlotStreamSeries(int capacity, int slack) : _Seq(0), _PublishedBegin(0), _PublishedEnd(0) {
+    IM_ASSERT(capacity > 0);
+    _Capacity = capacity;
+    _SlotCount = capacity + (slack >= 0 ? slack : capacity / 4);
+    _Slots = (_Slot*)IM_ALLOC(_SlotCount * sizeof(_Slot));
+    for (int i = 0; i < _SlotCount; ++i)
+        IM_PLACEMENT_NEW(&_Slots[i]) _Slot();
+    for (int q = 0; q < 4; ++q)
+        _Queues[q].Indices.resize(capacity);
+    _Begin = _End = 0;
+    Clear();
+}
+
+ImPlotStreamSeries::~ImPlotStreamSeries() {
+    for (int i = 0; i < _SlotCount; ++i)
+        _Slots[i].~_Slot();
+    IM_FREE(_Slots);
+}
+
+void ImPlotStreamSeries::Append(double x, double y) {
+    Append(&x, &y, 1);
+}
+
+void ImPlotStreamSeries::Append(const double* xs, const double* ys, int count) {
+    IM_ASSERT(count >= 0);
+    for (int i = 0; i < count; ++i) {
+        _Slot& slot = _Slots[_End % _SlotCount];
+        slot.X.store(xs[i], std::memory_order_relaxed);
+        slot.Y.store(ys[i], std::memory_order_relaxed);
+        _Push(0, _End, xs[i]);
+        _Push(1, _End, xs[i]);
+        _Push(2, _End, ys[i]);
+        _Push(3, _End, ys[i]);
+        _End++;
+    }
+    _Publish();
+}
+
+void ImPlotStreamSeries::Clear() {
+    // the slots keep their points, a plot may still be reading them
+    _Begin = _End;
+    for (int q = 0; q < 4; ++q)
+        _Queues[q].Front = _Queues[q].Size = 0;
+    _Publish();
+}
+
+int ImPlotStreamSeries::Size() const {
+    int first;
+    return _Snapshot(&first, nullptr);
+}
+
+ImPlotRect ImPlotStreamSeries::GetBounds() const {
+    int first;
+    ImPlotRect bounds;
+    _Snapshot(&first, &bounds);
+    return bounds;
+}
+
+int ImPlotStreamSeries::_Snapshot(int* first, ImPlotRect* bounds) const {
+    // seqlock: reading any value stored by a publication in progress also makes its odd sequence number visible
+    ImU64 begin, end;
+    double values[4];
+    for (;;) {
+        const ImU64 seq = _Seq.load(std::memory_order_acquire);
+        if (seq & 1)
+            continue;
+        begin = _PublishedBegin.load(std::memory_order_acquire);
+        end = _PublishedEnd.load(std::memory_order_acquire);
+        for (int q = 0; q < 4; ++q)
+            values[q] = _PublishedBounds[q].load(std::memory_order_acquire);
+        if (_Seq.load(std::memory_order_relaxed) == seq)
+            break;
+    }
+    if (bounds)
+        *bounds = ImPlotRect(values[0], values[1], values[2], values[3]);
+    const int count = (int)ImMin(end - begin, (ImU64)_Capacity);
+    *first = (int)((end - count) % _SlotCount);
+    return count;
+}
+
+void ImPlotStreamSeries::_Push(int queue_idx, ImU64 idx, double value) {
+    _Queue& queue = _Queues[queue_idx];
+    const int size = queue.Indices.Size;
+    // drop the points leaving the window, then the points that can no longer be the min (max) before pushing
+    while (queue.Size > 0 && queue.Indices[queue.Front] + _Capacity <= idx) {
+        queue.Front = (queue.Front + 1) % size;
+        queue.Size--;
+    }
+    if (ImNanOrInf(value))
+        return;
+    const bool is_max = (queue_idx & 1) != 0;
+    while (queue.Size > 0) {
+        const _Slot& back = _Slots[queue.Indices[(queue.Front + queue.Size - 1) % size] % _SlotCount];
+        const double back_value = (queue_idx < 2 ? back.X : back.Y).load(std::memory_order_relaxed);
+        if (is_max ? back_value > value : back_value < value)
+            break;
+        queue.Size--;
+    }
+    queue.Indices[(queue.Front + queue.Size) % size] = idx;
+    queue.Size++;
+}
+
+void ImPlotStreamSeries::_Publish() {
+    const ImU64 seq = _Seq.load(std::memory_order_relaxed);
+    _Seq.store(seq + 1, std::memory_order_relaxed);
+    _PublishedBegin.store(_Begin, std::memory_order_release);
+    _PublishedEnd.store(_End, std::memory_order_release);
+    for (int q = 0; q < 4; ++q) {
+        const _Queue& queue = _Queues[q];
+        double value = (q & 1) ? -INFINITY : INFINITY;
+        if (queue.Size > 0) {
+            const _Slot& front = _Slots[queue.Indices[queue.Front] % _SlotCount];
+            value = (q < 2 ? front.X : front.Y).load(std::memory_order_relaxed);
+        }
+        _PublishedBounds[q].store(value, std::memory_order_release);
+    }
+    _Seq.store(seq + 2, std::memory_order_release);
+}
+
 //-----------------------------------------------------------------------------
 // Style
 //-----------------------------------------------------------------------------
@@ -438,6 +710,10 @@ void DestroyContext(ImPlotContext* ctx) {
         ctx = GImPlot;
     if (GImPlot == ctx)
         SetCurrentContext(nullptr);
+    for (int i = 0; i < ctx->RenderShards.Size; ++i)
+        IM_DELETE(ctx->RenderShards[i]);
+    for (int i = 0; i < ctx->RenderPoints.Size; ++i)
+        IM_DELETE(ctx->RenderPoints[i]);
     IM_DELETE(ctx);
 }
 
@@ -457,6 +733,12 @@ void Initialize(ImPlotContext* ctx) {
     ResetCtxForNextAlignedPlots(ctx);
     ResetCtxForNextSubplot(ctx);
 
+    ctx->ParallelFor         = nullptr;
+    ctx->HistogramCacheFrame = -1;
+    ctx->ParallelRender      = 0;
+    ctx->ParallelRenderLock  = 0;
+    ctx->RenderPointsUsed    = 0;
+
     const ImU32 Deep[]     = {4289753676, 4283598045, 4285048917, 4283584196, 4289950337, 4284512403, 4291005402, 4287401100, 4285839820, 4291671396                        };
     const ImU32 Dark[]     = {4280031972, 4290281015, 4283084621, 4288892568, 4278222847, 4281597951, 4280833702, 4290740727, 4288256409                                    };
     const ImU32 Pastel[]   = {4289639675, 4293119411, 4291161036, 4293184478, 4289124862, 4291624959, 4290631909, 4293712637, 4294111986                                    };
@@ -521,6 +803,62 @@ void ResetCtxForNextSubplot(ImPlotContext* ctx) {
     ctx->CurrentAlignmentV   = nullptr;
 }
 
+static void GcCompactItemGroup(ImPlotItemGroup& items) {
+    items.Reset();
+    items.Legend.Indices.clear();
+    items.Legend.Labels.Buf.clear();
+}
+
+static void GcCompactTicker(ImPlotTicker& ticker) {
+    ticker.Reset();
+    ticker.Ticks.clear();
+    ticker.TextBuffer.Buf.clear();
+    ticker.Memo = nullptr;
+}
+
+void GcCompactTransientBuffers(ImPlotContext* ctx, int min_frame) {
+    IM_ASSERT_USER_ERROR(ctx->CurrentPlot == nullptr && ctx->CurrentSubplot == nullptr && ctx->ParallelRender == 0, "GcCompactTransientBuffers() needs to be called between frames!");
+    for (int i = 0; i < ctx->Plots.GetMapSize(); ++i) {
+        ImPlotPlot* plot = ctx->Plots.TryGetMapData(i);
+        if (plot == nullptr || plot->LastFrameActive >= min_frame)
+            continue;
+        GcCompactItemGroup(plot->Items);
+        plot->TextBuffer.Buf.clear();
+        for (int a = 0; a < ImAxis_COUNT; ++a) {
+            GcCompactTicker(plot->Axes[a].Ticker);
+            GcCompactTicker(plot->Axes[a].TickerCache);
+            plot->Axes[a].TickerCacheKey = ImPlotTickerKey();
+        }
+    }
+    for (int i = 0; i < ctx->Subplots.GetMapSize(); ++i) {
+        ImPlotSubplot* subplot = ctx->Subplots.TryGetMapData(i);
+        if (subplot != nullptr && subplot->LastFrameActive < min_frame)
+            GcCompactItemGroup(subplot->Items);
+    }
+    // caches and temporary buffers are rebuilt by the next plots needing them
+    ctx->HistogramCache.Clear();
+    ctx->HistogramCacheFrame = -1;
+    ctx->TempDouble1.clear();
+    ctx->TempDouble2.clear();
+    ctx->TempInt1.clear();
+    ctx->TempPoints.clear();
+    ctx->MousePosStringBuilder.Buf.clear();
+    ctx->Annotations.Reset();
+    ctx->Annotations.Annotations.clear();
+    ctx->Annotations.TextBuffer.Buf.clear();
+    ctx->Tags.Reset();
+    ctx->Tags.Tags.clear();
+    ctx->Tags.TextBuffer.Buf.clear();
+    for (int i = 0; i < ctx->RenderShards.Size; ++i)
+        ctx->RenderShards[i]->_ClearFreeMemory();
+    for (int i = 0; i < ctx->RenderPoints.Size; ++i)
+        ctx->RenderPoints[i]->clear();
+    ctx->MergeVtx.clear();
+    ctx->MergeIdx.clear();
+    ctx->MergeCmd.clear();
+    ctx->MergeCopies.clear();
+}
+
 //-----------------------------------------------------------------------------
 // Plot Utils
 //-----------------------------------------------------------------------------
@@ -541,6 +879,24 @@ void BustPlotCache() {
     gp.Subplots.Clear();
 }
 
+void BustTickCache(const char* plot_title_id) {
+    ImPlotContext& gp = *GImPlot;
+    if (plot_title_id == nullptr) {
+        for (int p = 0; p < gp.Plots.GetBufSize(); ++p) {
+            ImPlotPlot& plot = *gp.Plots.GetByIndex(p);
+            for (int i = 0; i < ImAxis_COUNT; ++i)
+                plot.Axes[i].TickerCacheKey = ImPlotTickerKey();
+        }
+    }
+    else {
+        ImPlotPlot* plot = gp.Plots.GetByKey(ImGui::GetCurrentWindow()->GetID(plot_title_id));
+        if (plot != nullptr) {
+            for (int i = 0; i < ImAxis_COUNT; ++i)
+                plot->Axes[i].TickerCacheKey = ImPlotTickerKey();
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Legend Utils
 //-----------------------------------------------------------------------------
@@ -840,6 +1196,63 @@ void AddTicksCustom(const double* values, const char* const labels[], int n, ImP
     }
 }
 
+static void CopyTicks(ImPlotTicker& dst, const ImPlotTicker& src) {
+    dst.Ticks.resize(src.Ticks.Size);
+    dst.TextBuffer.Buf.resize(src.TextBuffer.Buf.Size);
+    if (src.Ticks.Size > 0)
+        memcpy(dst.Ticks.Data, src.Ticks.Data, src.Ticks.Size * sizeof(ImPlotTick));
+    if (src.TextBuffer.Buf.Size > 0)
+        memcpy(dst.TextBuffer.Buf.Data, src.TextBuffer.Buf.Data, src.TextBuffer.Buf.Size);
+}
+
+// Locates the ticks of an axis, reusing the ticks of the previous frame while the range, size, scale, formatter and
+// font are unchanged. When only the range moved by the same span (e.g. panning), the labels of ticks at the same
+// positions are reused. Formatters are assumed to only depend on their value and data, see BustTickCache.
+void LocateTicks(ImPlotAxis& axis, float pixels, bool vertical) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotTicker& ticker = axis.Ticker;
+    // custom ticks from SetupAxisTicks are added every frame
+    if (ticker.TickCount() > 0) {
+        axis.Locator(ticker, axis.Range, pixels, vertical, axis.Formatter, axis.FormatterData);
+        return;
+    }
+    ImPlotTickerKey key;
+    key.Range          = axis.Range;
+    key.Pixels         = pixels;
+    key.Vertical       = vertical;
+    key.UseLocalTime   = gp.Style.UseLocalTime;
+    key.UseISO8601     = gp.Style.UseISO8601;
+    key.Use24HourClock = gp.Style.Use24HourClock;
+    key.Scale          = axis.Scale;
+    key.Locator        = axis.Locator;
+    key.Formatter      = axis.Formatter;
+    key.FormatterData  = axis.FormatterData;
+    memcpy(key.FormatSpec, axis.FormatSpec, sizeof(key.FormatSpec));
+    key.Font           = ImGui::GetFont();
+    key.FontSize       = ImGui::GetFontSize();
+    // size of late labels, see ImPlotTicker::Reset
+    const ImVec2 late_size = ticker.MaxSize;
+    ImPlotTicker& cache = axis.TickerCache;
+    if (memcmp(&key, &axis.TickerCacheKey, sizeof(key)) == 0) {
+        CopyTicks(ticker, cache);
+        ticker.MaxSize = cache.MaxSize;
+    }
+    else {
+        const ImPlotRange prev_range = axis.TickerCacheKey.Range;
+        axis.TickerCacheKey.Range    = key.Range;
+        const bool panned = memcmp(&key, &axis.TickerCacheKey, sizeof(key)) == 0 && ImAbs(key.Range.Size() - prev_range.Size()) <= 1e-9 * prev_range.Size();
+        ticker.Memo       = panned ? &cache : nullptr;
+        ticker.MemoCursor = 0;
+        ticker.MaxSize    = ImVec2(0,0);
+        axis.Locator(ticker, axis.Range, pixels, vertical, axis.Formatter, axis.FormatterData);
+        ticker.Memo       = nullptr;
+        CopyTicks(cache, ticker);
+        cache.MaxSize       = ticker.MaxSize;
+        axis.TickerCacheKey = key;
+    }
+    ticker.MaxSize = ImMax(ticker.MaxSize, late_size);
+}
+
 //-----------------------------------------------------------------------------
 // Time Ticks and Utils
 //-----------------------------------------------------------------------------
@@ -2389,13 +2802,14 @@ bool BeginPlot(const char* title_id, const ImVec2& size, ImPlotFlags flags) {
         return false;
     }
 
-    // ID and age (TODO: keep track of plot age in frames)
+    // ID and age
     const ImGuiID ID         = Window->GetID(title_id);
     const bool just_created  = gp.Plots.GetByKey(ID) == nullptr;
     gp.CurrentPlot           = gp.Plots.GetOrAddByKey(ID);
 
     ImPlotPlot &plot         = *gp.CurrentPlot;
     plot.ID                  = ID;
+    plot.LastFrameActive     = G.FrameCount;
     plot.Items.ID            = ID - 1;
     plot.JustCreated         = just_created;
     plot.SetupLocked         = false;
@@ -2571,7 +2985,7 @@ void SetupFinish() {
     for (int i = 0; i < IMPLOT_NUM_Y_AXES; i++) {
         ImPlotAxis& axis = plot.YAxis(i);
         if (axis.WillRender() && axis.ShowDefaultTicks && plot_height > 0) {
-            axis.Locator(axis.Ticker, axis.Range, plot_height, true, axis.Formatter, axis.FormatterData);
+            LocateTicks(axis, plot_height, true);
         }
     }
 
@@ -2584,7 +2998,7 @@ void SetupFinish() {
     for (int i = 0; i < IMPLOT_NUM_X_AXES; i++) {
         ImPlotAxis& axis = plot.XAxis(i);
         if (axis.WillRender() && axis.ShowDefaultTicks && plot_width > 0) {
-            axis.Locator(axis.Ticker, axis.Range, plot_width, false, axis.Formatter, axis.FormatterData);
+            LocateTicks(axis, plot_width, false);
         }
     }
 
@@ -3349,6 +3763,7 @@ bool BeginSubplots(const char* title, int rows, int cols, const ImVec2& size, Im
     ImPlotSubplot& subplot = *gp.CurrentSubplot;
     subplot.ID       = ID;
     subplot.Items.ID = ID - 1;
+    subplot.LastFrameActive = G.FrameCount;
     subplot.HasTitle = ImGui::FindRenderedTextEnd(title, nullptr) != title;
     // push ID
     ImGui::PushID(ID);
@@ -3531,6 +3946,9 @@ bool BeginSubplots(const char* title, int rows, int cols, const ImVec2& size, Im
         subplot.ColAlignmentData[c].Begin();
     // clear legend data
     subplot.Items.Legend.Reset();
+    // defer item rendering until EndSubplots
+    if (ImHasFlag(subplot.Flags, ImPlotSubplotFlags_ParallelRender))
+        BeginParallelRender();
     // Setup first subplot
     SubplotSetCell(0,0);
     return true;
@@ -3630,6 +4048,9 @@ void EndSubplots() {
     }
     // pop id
     ImGui::PopID();
+    // render the items of every subplot
+    if (ImHasFlag(subplot.Flags, ImPlotSubplotFlags_ParallelRender))
+        EndParallelRender();
     // set DC back correctly
     GImGui->CurrentWindow->DC.CursorPos = subplot.FrameRect.Min;
     ImGui::Dummy(subplot.FrameRect.GetSize());
@@ -4819,6 +5240,11 @@ void MapInputReverse(ImPlotInputMap* dst) {
 // [Section] Miscellaneous
 //-----------------------------------------------------------------------------
 
+void SetParallelFor(ImPlotParallelFor parallel_for) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    GImPlot->ParallelFor = parallel_for;
+}
+
 void ItemIcon(const ImVec4& col) {
     ItemIcon(ImGui::ColorConvertFloat4ToU32(col));
 }
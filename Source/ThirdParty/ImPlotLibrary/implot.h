@@ -46,6 +46,7 @@
 
 #pragma once
 #include "imgui.h"
+#include <atomic>
 
 //-----------------------------------------------------------------------------
 // [SECTION] Macros and Defines
@@ -178,7 +179,8 @@ enum ImPlotSubplotFlags_ {
     ImPlotSubplotFlags_LinkCols    = 1 << 7,  // link the x-axis limits of all plots in each column (does not apply to auxiliary axes)
     ImPlotSubplotFlags_LinkAllX    = 1 << 8,  // link the x-axis limits in every plot in the subplot (does not apply to auxiliary axes)
     ImPlotSubplotFlags_LinkAllY    = 1 << 9,  // link the y-axis limits in every plot in the subplot (does not apply to auxiliary axes)
-    ImPlotSubplotFlags_ColMajor    = 1 << 10  // subplots are added in column major order instead of the default row major order
+    ImPlotSubplotFlags_ColMajor    = 1 << 10, // subplots are added in column major order instead of the default row major order
+    ImPlotSubplotFlags_ParallelRender = 1 << 11 // item geometry is generated on worker threads by EndSubplots (see BeginParallelRender)
 };
 
 // Options for legends (see SetupLegend)
@@ -227,12 +229,14 @@ enum ImPlotItemFlags_ {
 
 // Flags for PlotLine
 enum ImPlotLineFlags_ {
-    ImPlotLineFlags_None        = 0,       // default
-    ImPlotLineFlags_Segments    = 1 << 10, // a line segment will be rendered from every two consecutive points
-    ImPlotLineFlags_Loop        = 1 << 11, // the last and first point will be connected to form a closed loop
-    ImPlotLineFlags_SkipNaN     = 1 << 12, // NaNs values will be skipped instead of rendered as missing data
-    ImPlotLineFlags_NoClip      = 1 << 13, // markers (if displayed) on the edge of a plot will not be clipped
-    ImPlotLineFlags_Shaded      = 1 << 14, // a filled region between the line and horizontal origin will be rendered; use PlotShaded for more advanced cases
+    ImPlotLineFlags_None           = 0,       // default
+    ImPlotLineFlags_Segments       = 1 << 10, // a line segment will be rendered from every two consecutive points
+    ImPlotLineFlags_Loop           = 1 << 11, // the last and first point will be connected to form a closed loop
+    ImPlotLineFlags_SkipNaN        = 1 << 12, // NaNs values will be skipped instead of rendered as missing data
+    ImPlotLineFlags_NoClip         = 1 << 13, // markers (if displayed) on the edge of a plot will not be clipped
+    ImPlotLineFlags_Shaded         = 1 << 14, // a filled region between the line and horizontal origin will be rendered; use PlotShaded for more advanced cases
+    ImPlotLineFlags_NoDownsample   = 1 << 15, // every point will be rendered; by default series with many more points than the plot has pixel columns are reduced to the first/min/max/last point of each column (requires monotonic x)
+    ImPlotLineFlags_DownsampleLTTB = 1 << 16, // series will be downsampled with Largest-Triangle-Three-Buckets instead (smoother, but isolated spikes may be dropped)
 };
 
 // Flags for PlotScatter
@@ -243,9 +247,11 @@ enum ImPlotScatterFlags_ {
 
 // Flags for PlotStairs
 enum ImPlotStairsFlags_ {
-    ImPlotStairsFlags_None     = 0,       // default
-    ImPlotStairsFlags_PreStep  = 1 << 10, // the y value is continued constantly to the left from every x position, i.e. the interval (x[i-1], x[i]] has the value y[i]
-    ImPlotStairsFlags_Shaded   = 1 << 11  // a filled region between the stairs and horizontal origin will be rendered; use PlotShaded for more advanced cases
+    ImPlotStairsFlags_None           = 0,       // default
+    ImPlotStairsFlags_PreStep        = 1 << 10, // the y value is continued constantly to the left from every x position, i.e. the interval (x[i-1], x[i]] has the value y[i]
+    ImPlotStairsFlags_Shaded         = 1 << 11, // a filled region between the stairs and horizontal origin will be rendered; use PlotShaded for more advanced cases
+    ImPlotStairsFlags_NoDownsample   = 1 << 12, // every point will be rendered, see ImPlotLineFlags_NoDownsample
+    ImPlotStairsFlags_DownsampleLTTB = 1 << 13  // series will be downsampled with Largest-Triangle-Three-Buckets instead of per pixel column min/max
 };
 
 // Flags for PlotShaded (placeholder)
@@ -304,7 +310,8 @@ enum ImPlotHistogramFlags_ {
     ImPlotHistogramFlags_Cumulative = 1 << 11, // each bin will contain its count plus the counts of all previous bins (not supported by PlotHistogram2D)
     ImPlotHistogramFlags_Density    = 1 << 12, // counts will be normalized, i.e. the PDF will be visualized, or the CDF will be visualized if Cumulative is also set
     ImPlotHistogramFlags_NoOutliers = 1 << 13, // exclude values outside the specifed histogram range from the count toward normalizing and cumulative counts
-    ImPlotHistogramFlags_ColMajor   = 1 << 14  // data will be read in column major order (not supported by PlotHistogram)
+    ImPlotHistogramFlags_ColMajor   = 1 << 14, // data will be read in column major order (not supported by PlotHistogram)
+    ImPlotHistogramFlags_Cache      = 1 << 15  // bins are kept between frames and reused while the data pointer(s), count, bins, range and flags are unchanged (the data must not be modified in place)
 };
 
 // Flags for PlotDigital (placeholder)
@@ -577,6 +584,93 @@ struct ImPlotInputMap {
     IMPLOT_API ImPlotInputMap();
 };
 
+// Plot data with a cached min/max pyramid, for very large or growing series plotted with PlotLine/PlotStairs. Every node
+// of the pyramid holds the y extremes of a block of points, 16 points at the bottom and twice as many on each level up.
+// It is built once by SetData and updated incrementally by Append. When x values are non-decreasing, fitting the axes
+// queries the pyramid and rendering only visits the visible points, reduced to the first, min, max and last point of each
+// pixel column, so the cost of a frame depends on the size of the plot rather than on the number of points.
+struct ImPlotSeries {
+    struct Node {
+        double YMin, YMax;
+        int    IdxMin, IdxMax; // -1 if the block only has NaNs
+    };
+
+    ImVector<double> Xs;         // x values, empty if x is XStart + index * XScale
+    ImVector<double> Ys;         // y values, NaNs are skipped by the pyramid
+    double           XStart;
+    double           XScale;
+    bool             XMonotonic; // x values are finite and non-decreasing, otherwise the series is fitted and rendered in full
+    ImVector<Node>   Levels[28]; // Levels[l][i] covers the points [(i << l) * 16, ((i + 1) << l) * 16)
+
+    IMPLOT_API ImPlotSeries();
+    IMPLOT_API void SetData(const double* ys, int count, double xscale=1, double xstart=0);
+    IMPLOT_API void SetData(const double* xs, const double* ys, int count);
+    IMPLOT_API void Append(double y);                                  // x continues XStart + index * XScale
+    IMPLOT_API void Append(double x, double y);
+    IMPLOT_API void Append(const double* xs, const double* ys, int count); // xs can be nullptr if x is uniform
+    IMPLOT_API void Clear();
+
+    int    Size() const         { return Ys.Size; }
+    double GetX(int idx) const  { return Xs.Size > 0 ? Xs.Data[idx] : XStart + idx * XScale; }
+    double GetY(int idx) const  { return Ys.Data[idx]; }
+
+    // First index with x >= value (LowerBound) or x > value (UpperBound), requires XMonotonic.
+    IMPLOT_API int  LowerBound(double x) const;
+    IMPLOT_API int  UpperBound(double x) const;
+    // Indices of the min and max y values in [first, last), returns false if the range only has NaNs.
+    IMPLOT_API bool FindMinMax(int first, int last, int* idx_min, int* idx_max) const;
+
+    IMPLOT_API void _UpdateLevels(int first);
+};
+
+// Fixed capacity ring buffer for live data plotted with PlotLine/PlotScatter, keeping the newest Capacity points. A single
+// producer thread can Append while another thread plots: the plot reads the points published when it began in place,
+// without locking or copying. The buffer has Slack extra slots, so the producer must not append more than Slack points
+// while a plot is being drawn, or the oldest points drawn may be overwritten. Appends also maintain the bounds of the
+// points in the buffer (monotonic queues, amortized O(1)), so fitting the axes doesn't visit the points.
+struct ImPlotStreamSeries {
+    IMPLOT_API ImPlotStreamSeries(int capacity, int slack=-1); // slack defaults to capacity / 4
+    IMPLOT_API ~ImPlotStreamSeries();
+    ImPlotStreamSeries(const ImPlotStreamSeries&) = delete;
+    ImPlotStreamSeries& operator=(const ImPlotStreamSeries&) = delete;
+
+    // Producer thread
+    IMPLOT_API void Append(double x, double y);
+    IMPLOT_API void Append(const double* xs, const double* ys, int count);
+    IMPLOT_API void Clear();
+
+    // Any thread
+    int Capacity() const { return _Capacity; }
+    IMPLOT_API int  Size() const;
+    // Bounds of the finite values of the points published so far, Min > Max on an axis without finite values.
+    IMPLOT_API ImPlotRect GetBounds() const;
+    // Consistent view of the points published: returns their number, the oldest being stored in _Slots[*first].
+    IMPLOT_API int _Snapshot(int* first, ImPlotRect* bounds) const;
+
+    struct _Slot { // accessed with relaxed atomics, as the producer may overwrite a slot being read
+        std::atomic<double> X, Y;
+    };
+
+    struct _Queue { // indices of increasing (or decreasing) values, oldest first
+        ImVector<ImU64> Indices;
+        int             Front, Size;
+    };
+
+    _Slot*                _Slots;        // Capacity + Slack slots, point n is stored in _Slots[n % _SlotCount]
+    int                   _SlotCount;
+    int                   _Capacity;
+    ImU64                 _Begin;        // number of points appended before the last Clear, producer side
+    ImU64                 _End;          // number of points appended, producer side
+    _Queue                _Queues[4];    // x min, x max, y min, y max of the newest Capacity points, producer side
+    std::atomic<ImU64>    _Seq;          // odd while publishing
+    std::atomic<ImU64>    _PublishedBegin;
+    std::atomic<ImU64>    _PublishedEnd;
+    std::atomic<double>   _PublishedBounds[4];
+
+    void _Push(int queue, ImU64 idx, double value);
+    void _Publish();
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Callbacks
 //-----------------------------------------------------------------------------
@@ -590,6 +684,9 @@ typedef ImPlotPoint (*ImPlotGetter)(int idx, void* user_data);
 // Callback signature for axis transform.
 typedef double (*ImPlotTransform)(double value, void* user_data);
 
+// Callback signature for running func(index, user_data) for every index in [0,count), possibly concurrently, returning once all calls are done.
+typedef void (*ImPlotParallelFor)(int count, void (*func)(int index, void* user_data), void* user_data);
+
 namespace ImPlot {
 
 //-----------------------------------------------------------------------------
@@ -856,16 +953,24 @@ IMPLOT_API void SetNextAxesToFit();
 IMPLOT_TMP void PlotLine(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, ImPlotLineFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, int count, ImPlotLineFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotLineG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotLineFlags flags=0);
+// Plots a line from a cached series, only visiting the visible points at the plot's resolution if x is monotonic (see ImPlotSeries). ImPlotLineFlags_DownsampleLTTB is then ignored.
+IMPLOT_API void PlotLine(const char* label_id, const ImPlotSeries& series, ImPlotLineFlags flags=0);
+// Plots a line from a stream, see ImPlotStreamSeries. Safe to call while the stream's producer thread appends.
+IMPLOT_API void PlotLine(const char* label_id, const ImPlotStreamSeries& stream, ImPlotLineFlags flags=0);
 
 // Plots a standard 2D scatter plot. Default marker is ImPlotMarker_Circle.
 IMPLOT_TMP void PlotScatter(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, ImPlotScatterFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_TMP void PlotScatter(const char* label_id, const T* xs, const T* ys, int count, ImPlotScatterFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotScatterG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotScatterFlags flags=0);
+// Plots a scatter plot from a stream, see ImPlotStreamSeries. Safe to call while the stream's producer thread appends.
+IMPLOT_API void PlotScatter(const char* label_id, const ImPlotStreamSeries& stream, ImPlotScatterFlags flags=0);
 
 // Plots a a stairstep graph. The y value is continued constantly to the right from every x position, i.e. the interval [x[i], x[i+1]) has the value y[i]
 IMPLOT_TMP void PlotStairs(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, ImPlotStairsFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_TMP void PlotStairs(const char* label_id, const T* xs, const T* ys, int count, ImPlotStairsFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotStairsG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotStairsFlags flags=0);
+// Plots a stairstep graph from a cached series, see PlotLine(const char*, const ImPlotSeries&).
+IMPLOT_API void PlotStairs(const char* label_id, const ImPlotSeries& series, ImPlotStairsFlags flags=0);
 
 // Plots a shaded (filled) region between two lines, or a line and a horizontal reference. Set yref to +/-INFINITY for infinite fill extents.
 IMPLOT_TMP void PlotShaded(const char* label_id, const T* values, int count, double yref=0, double xscale=1, double xstart=0, ImPlotShadedFlags flags=0, int offset=0, int stride=sizeof(T));
@@ -1197,6 +1302,12 @@ IMPLOT_API bool ColormapButton(const char* label, const ImVec2& size = ImVec2(0,
 // need this function, but it is available for applications that require runtime colormap swaps (e.g. Heatmaps demo).
 IMPLOT_API void BustColorCache(const char* plot_title_id = nullptr);
 
+// Axis ticks and their labels are cached and only located and formatted again when the axis range, size, scale,
+// format or font change. If a custom formatter (see SetupAxisFormat) produces different labels for the same value
+// and user data (e.g. after changing units), use this function to bust the cached labels. If #plot_title_id is nullptr,
+// then the ticks of EVERY existing plot will be cache busted, otherwise only those of the plot specified by #plot_title_id.
+IMPLOT_API void BustTickCache(const char* plot_title_id = nullptr);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Input Mapping
 //-----------------------------------------------------------------------------
@@ -1225,6 +1336,25 @@ IMPLOT_API void PushPlotClipRect(float expand=0);
 // Pop plot clip rect. Call between Begin/EndPlot.
 IMPLOT_API void PopPlotClipRect();
 
+// Reserves space in a font atlas for anti-aliased marker sprites, so that markers are rendered as one textured quad
+// instead of being tessellated. Call before the atlas is built, then call BuildMarkerSprites once it is.
+IMPLOT_API void AddMarkerSprites(ImFontAtlas* atlas);
+// Rasterizes the marker sprites into the pixels of the built atlas (TexPixelsAlpha8 and TexPixelsRGBA32 if present),
+// before they are uploaded. Must be called again every time the atlas is rebuilt.
+IMPLOT_API void BuildMarkerSprites(ImFontAtlas* atlas);
+
+// Sets the callback used to split large histograms and parallel rendering across worker threads. Pass nullptr (default) to
+// do all the work on the calling thread.
+IMPLOT_API void SetParallelFor(ImPlotParallelFor parallel_for);
+
+// Defers the geometry of the items of every plot until the matching EndParallelRender, which generates it on worker threads
+// through the SetParallelFor callback and splices it into the draw lists in submission order, giving the same draw data as
+// rendering each item immediately. Until then the plotted data, ImPlotSeries and getters must remain valid and unchanged,
+// and getter and axis transform callbacks are called from worker threads. Calls can be nested, and are made by
+// BeginSubplots/EndSubplots with ImPlotSubplotFlags_ParallelRender. EndParallelRender must be called before ImGui::Render.
+IMPLOT_API void BeginParallelRender();
+IMPLOT_API void EndParallelRender();
+
 // Shows ImPlot style selector dropdown menu.
 IMPLOT_API bool ShowStyleSelector(const char* label);
 // Shows ImPlot colormap selector dropdown menu.
@@ -911,6 +911,14 @@ void Demo_RealtimePlots() {
         ImPlot::PlotLine("Mouse Y", &rdata2.Data[0].x, &rdata2.Data[0].y, rdata2.Data.size(), 0, 0, 2 * sizeof(float));
         ImPlot::EndPlot();
     }
+    // ImPlotStreamSeries can be appended to from another thread while it is plotted, and fits without visiting its points
+    static ImPlotStreamSeries stream(2000);
+    stream.Append(t, mouse.x * 0.0005f);
+    if (ImPlot::BeginPlot("##Stream", ImVec2(-1,150))) {
+        ImPlot::SetupAxes(nullptr, nullptr, flags | ImPlotAxisFlags_AutoFit, flags | ImPlotAxisFlags_AutoFit);
+        ImPlot::PlotLine("Mouse X", stream);
+        ImPlot::EndPlot();
+    }
 }
 
 //-----------------------------------------------------------------------------
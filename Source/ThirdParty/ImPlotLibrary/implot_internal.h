@@ -59,6 +59,20 @@
 #define IMPLOT_LABEL_FORMAT "%g"
 // Max character size for tick labels
 #define IMPLOT_LABEL_MAX_SIZE 32
+// Line and stairs plots with more points than this per pixel of plot width are downsampled before rendering
+#define IMPLOT_DOWNSAMPLE_POINTS_PER_PIXEL 4
+// Number of points renderers fetch from getters and transform to pixels at once
+#define IMPLOT_TRANSFORM_BATCH_SIZE 256
+// Minimum number of samples binned by each task of a parallel histogram
+#define IMPLOT_HISTOGRAM_CHUNK_SIZE 65536
+// Maximum number of tasks a histogram is split into
+#define IMPLOT_HISTOGRAM_MAX_CHUNKS 64
+// Maximum vertices or indices per task when EndParallelRender() splices deferred geometry
+#define IMPLOT_RENDER_COPY_SIZE 65536
+// Marker sprites are rasterized for marker sizes from 1 to this size
+#define IMPLOT_MARKER_SPRITE_MAX_SIZE 12
+// Marker sprites are rasterized for marker weights from 1 to this weight
+#define IMPLOT_MARKER_SPRITE_MAX_WEIGHT 2
 
 //-----------------------------------------------------------------------------
 // [SECTION] Macros
@@ -557,8 +571,12 @@ struct ImPlotTicker {
     ImVec2               MaxSize;
     ImVec2               LateSize;
     int                  Levels;
+    const ImPlotTicker*  Memo;       // ticks of a previous frame whose labels are reused for ticks at the same positions (e.g. while panning)
+    int                  MemoCursor;
 
     ImPlotTicker() {
+        Memo = nullptr;
+        MemoCursor = 0;
         Reset();
     }
 
@@ -575,15 +593,52 @@ struct ImPlotTicker {
     ImPlotTick& AddTick(double value, bool major, int level, bool show_label, ImPlotFormatter formatter, void* data) {
         ImPlotTick tick(value, major, level, show_label);
         if (show_label && formatter != nullptr) {
-            char buff[IMPLOT_LABEL_MAX_SIZE];
             tick.TextOffset = TextBuffer.size();
-            formatter(tick.PlotPos, buff, sizeof(buff), data);
-            TextBuffer.append(buff, buff + strlen(buff) + 1);
-            tick.LabelSize = ImGui::CalcTextSize(TextBuffer.Buf.Data + tick.TextOffset);
+            if (const ImPlotTick* memo = FindMemo(tick)) {
+                const char* label = Memo->GetText(memo->Idx);
+                TextBuffer.append(label, label + strlen(label) + 1);
+                tick.LabelSize = memo->LabelSize;
+            }
+            else {
+                char buff[IMPLOT_LABEL_MAX_SIZE];
+                formatter(tick.PlotPos, buff, sizeof(buff), data);
+                TextBuffer.append(buff, buff + strlen(buff) + 1);
+                tick.LabelSize = ImGui::CalcTextSize(TextBuffer.Buf.Data + tick.TextOffset);
+            }
         }
         return AddTick(tick);
     }
 
+    // Finds the tick with a label at the same position and level in Memo. Ticks are searched from the last match since
+    // locators add them in the same order every frame. The first tick of an upper level is never reused, time locators
+    // format it differently (e.g. with the full date).
+    const ImPlotTick* FindMemo(const ImPlotTick& tick) {
+        if (Memo == nullptr || Memo->Ticks.Size == 0)
+            return nullptr;
+        if (tick.Level > 0 && FindLevel(tick.Level) < 0)
+            return nullptr;
+        for (int n = 0; n < Memo->Ticks.Size; ++n) {
+            const int i = (MemoCursor + n) % Memo->Ticks.Size;
+            const ImPlotTick& memo = Memo->Ticks[i];
+            if (memo.PlotPos == tick.PlotPos && memo.Level == tick.Level && memo.Major == tick.Major && memo.TextOffset >= 0) {
+                if (memo.Level > 0 && Memo->FindLevel(memo.Level) == i)
+                    return nullptr;
+                MemoCursor = i + 1;
+                return &memo;
+            }
+        }
+        return nullptr;
+    }
+
+    // Returns the index of the first tick at a level, or -1
+    int FindLevel(int level) const {
+        for (int i = 0; i < Ticks.Size; ++i) {
+            if (Ticks[i].Level == level)
+                return i;
+        }
+        return -1;
+    }
+
     inline ImPlotTick& AddTick(ImPlotTick tick) {
         if (tick.ShowLabel) {
             MaxSize.x     =  tick.LabelSize.x > MaxSize.x ? tick.LabelSize.x : MaxSize.x;
@@ -620,6 +675,22 @@ struct ImPlotTicker {
     }
 };
 
+// Inputs of an axis locator, ticks are located again only when they change
+struct ImPlotTickerKey {
+    ImPlotRange     Range;
+    float           Pixels;
+    bool            Vertical;
+    bool            UseLocalTime, UseISO8601, Use24HourClock;
+    ImPlotScale     Scale;
+    ImPlotLocator   Locator;
+    ImPlotFormatter Formatter;
+    void*           FormatterData;
+    char            FormatSpec[16];
+    ImFont*         Font;
+    float           FontSize;
+    ImPlotTickerKey() { memset((void*)this, 0, sizeof(*this)); } // zero the padding for comparisons
+};
+
 // Axis state information that must persist after EndPlot
 struct ImPlotAxis
 {
@@ -635,6 +706,8 @@ struct ImPlotAxis
     ImPlotRange          ConstraintZoom;
 
     ImPlotTicker         Ticker;
+    ImPlotTicker         TickerCache;    // ticks located with TickerCacheKey, reused while it does not change
+    ImPlotTickerKey      TickerCacheKey;
     ImPlotFormatter      Formatter;
     void*                FormatterData;
     char                 FormatSpec[16];
@@ -1038,6 +1111,7 @@ struct ImPlotPlot
     bool                 Selecting;
     bool                 Selected;
     bool                 ContextLocked;
+    int                  LastFrameActive; // last ImGui frame the plot was begun in, for GcCompactTransientBuffers()
 
     ImPlotPlot() {
         Flags             = PreviousFlags = ImPlotFlags_None;
@@ -1054,6 +1128,7 @@ struct ImPlotPlot
         JustCreated       = true;
         Initialized = SetupLocked = FitThisFrame = false;
         Hovered = Held = Selected = Selecting = ContextLocked = false;
+        LastFrameActive   = -1;
     }
 
     inline bool IsInputLocked() const {
@@ -1135,6 +1210,7 @@ struct ImPlotSubplot {
     float                         TempSizes[2];
     bool                          FrameHovered;
     bool                          HasTitle;
+    int                           LastFrameActive;
 
     ImPlotSubplot() {
         ID                          = 0;
@@ -1146,6 +1222,7 @@ struct ImPlotSubplot {
         TempSizes[0] = TempSizes[1] = 0;
         FrameHovered                = false;
         HasTitle                    = false;
+        LastFrameActive             = -1;
     }
 };
 
@@ -1200,6 +1277,72 @@ struct ImPlotNextItemData {
     }
 };
 
+// A marker rasterized into a font atlas, see AddMarkerSprites
+struct ImPlotMarkerSprite {
+    int    RectId;   // custom rect of the font atlas, -1 if this marker has no sprite
+    float  Radius;   // marker size the sprite was rasterized for
+    float  HalfSize; // half the width and height of the sprite in pixels
+    ImVec2 UV0, UV1;
+};
+
+// Marker sprites of every shape, size and weight
+struct ImPlotMarkerSprites {
+    ImFontAtlas*       Atlas;
+    bool               Ready; // set once BuildMarkerSprites rasterized the sprites
+    // [marker][0: filled, 1..MAX_WEIGHT: outlined, MAX_WEIGHT+1..2*MAX_WEIGHT: filled and outlined][size-1]
+    ImPlotMarkerSprite Sprites[ImPlotMarker_COUNT][1 + 2 * IMPLOT_MARKER_SPRITE_MAX_WEIGHT][IMPLOT_MARKER_SPRITE_MAX_SIZE];
+    ImPlotMarkerSprites() { Atlas = nullptr; Ready = false; }
+};
+
+// Inputs of a histogram, hashed to find its ImPlotHistogramCache
+struct ImPlotHistogramKey {
+    const void* Xs;
+    const void* Ys;
+    int         Count;
+    int         XBins, YBins;
+    int         Flags;
+    int         TypeSize;
+    ImPlotRect  Range;
+    ImPlotHistogramKey() { memset((void*)this, 0, sizeof(*this)); } // zero the padding for hashing
+};
+
+// Bins of a histogram plotted with ImPlotHistogramFlags_Cache
+struct ImPlotHistogramCache {
+    ImPlotHistogramKey Key;
+    ImVector<double>   Counts;
+    ImPlotRect         Range;        // range after auto-fitting
+    int                XBins, YBins; // bins after ImPlotBin_ methods
+    double             Width, Height;
+    double             MaxCount;
+    int                LastFrame;
+    ImPlotHistogramCache() { XBins = YBins = 0; Width = Height = MaxCount = 0; LastFrame = -1; }
+};
+
+// Geometry of an item recorded between BeginParallelRender() and EndParallelRender(). The item leaves a placeholder
+// command in DrawList, its geometry is generated into Shard on a worker thread and then spliced in place of it.
+struct ImPlotRenderJob {
+    ImDrawList*     DrawList;               // draw list the item was submitted to
+    ImDrawList*     Shard;                  // draw list the geometry is generated into
+    ImDrawCmdHeader Header;                 // clip rect and texture of DrawList when the item was submitted
+    ImRect          CullRect;
+    int             VtxCut;                 // size of DrawList's vertex buffer when the item was submitted
+    int             VtxReserve, IdxReserve; // upper bounds of the geometry, reserved before going wide
+    int             VtxBase;                // position of the shard's vertices in the merged vertex buffer
+    int             VtxShift;               // shard vertices inserted before DrawList's vertex VtxCut, including this one
+    ImPlotRenderJob() { DrawList = Shard = nullptr; memset((void*)&Header, 0, sizeof(Header)); VtxCut = VtxReserve = IdxReserve = VtxBase = VtxShift = 0; }
+    virtual ~ImPlotRenderJob() { }
+    virtual void Render() = 0;
+};
+
+// Vertices or indices copied by EndParallelRender() to splice deferred geometry, indices are rebased as they are copied
+struct ImPlotRenderCopy {
+    const void*  Src;
+    void*        Dst;
+    int          Count;
+    unsigned int Rebase;
+    bool         Indices;
+};
+
 // Holds state information that must persist between calls to BeginPlot()/EndPlot()
 struct ImPlotContext {
     // Plot States
@@ -1224,6 +1367,7 @@ struct ImPlotContext {
     ImVector<ImGuiStyleMod>     StyleModifiers;
     ImPlotColormapData          ColormapData;
     ImVector<ImPlotColormap>    ColormapModifiers;
+    ImPlotMarkerSprites         MarkerSprites;
 
     // Time
     tm Tm;
@@ -1231,6 +1375,7 @@ struct ImPlotContext {
     // Temp data for general use
     ImVector<double>   TempDouble1, TempDouble2;
     ImVector<int>      TempInt1;
+    ImVector<ImPlotPoint> TempPoints;
 
     // Misc
     int                DigitalPlotItemCnt;
@@ -1241,6 +1386,23 @@ struct ImPlotContext {
     bool               OpenContextThisFrame;
     ImGuiTextBuffer    MousePosStringBuilder;
     ImPlotItemGroup*   SortItems;
+    ImPlotParallelFor  ParallelFor;
+
+    // Histograms
+    ImPool<ImPlotHistogramCache> HistogramCache;
+    int                          HistogramCacheFrame;
+
+    // Parallel rendering
+    int                               ParallelRender;     // BeginParallelRender() depth
+    int                               ParallelRenderLock; // > 0 while items are rendered from temp buffers, which can't be deferred
+    ImVector<ImPlotRenderJob*>        RenderJobs;
+    ImVector<ImDrawList*>             RenderShards;
+    ImVector<ImVector<ImPlotPoint>*>  RenderPoints;       // downsampled points of deferred items
+    int                               RenderPointsUsed;
+    ImVector<ImDrawVert>              MergeVtx;
+    ImVector<ImDrawIdx>               MergeIdx;
+    ImVector<ImDrawCmd>               MergeCmd;
+    ImVector<ImPlotRenderCopy>        MergeCopies;
 
     // Align plots
     ImPool<ImPlotAlignmentData> AlignmentData;
@@ -1267,6 +1429,10 @@ IMPLOT_API void ResetCtxForNextPlot(ImPlotContext* ctx);
 IMPLOT_API void ResetCtxForNextAlignedPlots(ImPlotContext* ctx);
 // Resets an ImPlot context for the next call to BeginSubplot
 IMPLOT_API void ResetCtxForNextSubplot(ImPlotContext* ctx);
+// Frees the items, legends and ticks of plots and subplots not begun since before min_frame, and the temporary and
+// cached buffers of the context. Items are recreated with their default visibility and colors when the plots reappear.
+// Must be called outside of an ImGui frame, e.g. with ImGui's own compaction before NewFrame().
+IMPLOT_API void GcCompactTransientBuffers(ImPlotContext* ctx, int min_frame);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Utils
@@ -1425,6 +1591,15 @@ IMPLOT_API void ShowAltLegend(const char* title_id, bool vertical = true, const
 // Shows a legend's context menu.
 IMPLOT_API bool ShowLegendContextMenu(ImPlotLegend& legend, bool visible);
 
+//-----------------------------------------------------------------------------
+// [SECTION] Marker Sprite Utils
+//-----------------------------------------------------------------------------
+
+// Same as AddMarkerSprites and BuildMarkerSprites for sprites outside of a context, e.g. to build an atlas on another
+// thread. Copy the built sprites into the MarkerSprites of every context drawing with the atlas.
+IMPLOT_API void AddMarkerSprites(ImFontAtlas* atlas, ImPlotMarkerSprites& sprites);
+IMPLOT_API void BuildMarkerSprites(ImFontAtlas* atlas, ImPlotMarkerSprites& sprites);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Label Utils
 //-----------------------------------------------------------------------------
@@ -1484,6 +1659,10 @@ IMPLOT_API ImU32  SampleColormapU32(float t, ImPlotColormap cmap);
 // Render a colormap bar
 IMPLOT_API void RenderColorBar(const ImU32* colors, int size, ImDrawList& DrawList, const ImRect& bounds, bool vert, bool reversed, bool continuous);
 
+// Render the labels of the heatmap cells that are visible and large enough on screen to fit them
+template <typename T>
+IMPLOT_API void RenderHeatmapLabels(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Math and Misc Utils
 //-----------------------------------------------------------------------------
@@ -1666,4 +1845,7 @@ void Locator_Time(ImPlotTicker& ticker, const ImPlotRange& range, float pixels,
 void Locator_Log10(ImPlotTicker& ticker, const ImPlotRange& range, float pixels, bool vertical, ImPlotFormatter formatter, void* formatter_data);
 void Locator_SymLog(ImPlotTicker& ticker, const ImPlotRange& range, float pixels, bool vertical, ImPlotFormatter formatter, void* formatter_data);
 
+// Locates the ticks of an axis with its locator, or reuses them from the previous frame
+IMPLOT_API void LocateTicks(ImPlotAxis& axis, float pixels, bool vertical);
+
 } // namespace ImPlot
@@ -189,6 +189,34 @@ IMPLOT_INLINE void PrimRectFill(ImDrawList& draw_list, const ImVec2& Pmin, const
     draw_list._VtxCurrentIdx += 4;
 }
 
+IMPLOT_INLINE void PrimRectUV(ImDrawList& draw_list, const ImVec2& Pmin, const ImVec2& Pmax, const ImVec2& uv0, const ImVec2& uv1, ImU32 col) {
+    draw_list._VtxWritePtr[0].pos   = Pmin;
+    draw_list._VtxWritePtr[0].uv    = uv0;
+    draw_list._VtxWritePtr[0].col   = col;
+    draw_list._VtxWritePtr[1].pos   = Pmax;
+    draw_list._VtxWritePtr[1].uv    = uv1;
+    draw_list._VtxWritePtr[1].col   = col;
+    draw_list._VtxWritePtr[2].pos.x = Pmin.x;
+    draw_list._VtxWritePtr[2].pos.y = Pmax.y;
+    draw_list._VtxWritePtr[2].uv.x  = uv0.x;
+    draw_list._VtxWritePtr[2].uv.y  = uv1.y;
+    draw_list._VtxWritePtr[2].col   = col;
+    draw_list._VtxWritePtr[3].pos.x = Pmax.x;
+    draw_list._VtxWritePtr[3].pos.y = Pmin.y;
+    draw_list._VtxWritePtr[3].uv.x  = uv1.x;
+    draw_list._VtxWritePtr[3].uv.y  = uv0.y;
+    draw_list._VtxWritePtr[3].col   = col;
+    draw_list._VtxWritePtr += 4;
+    draw_list._IdxWritePtr[0] = (ImDrawIdx)(draw_list._VtxCurrentIdx);
+    draw_list._IdxWritePtr[1] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 1);
+    draw_list._IdxWritePtr[2] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 2);
+    draw_list._IdxWritePtr[3] = (ImDrawIdx)(draw_list._VtxCurrentIdx);
+    draw_list._IdxWritePtr[4] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 1);
+    draw_list._IdxWritePtr[5] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 3);
+    draw_list._IdxWritePtr += 6;
+    draw_list._VtxCurrentIdx += 4;
+}
+
 IMPLOT_INLINE void PrimRectLine(ImDrawList& draw_list, const ImVec2& Pmin, const ImVec2& Pmax, float weight, ImU32 col, const ImVec2& uv) {
 
     draw_list._VtxWritePtr[0].pos.x = Pmin.x;
@@ -529,8 +557,8 @@ struct IndexerAdd {
     template <typename I> IMPLOT_INLINE double operator()(I idx) const {
         return Scale1 * Indexer1(idx) + Scale2 * Indexer2(idx);
     }
-    const _Indexer1& Indexer1;
-    const _Indexer2& Indexer2;
+    const _Indexer1 Indexer1;
+    const _Indexer2 Indexer2;
     double Scale1;
     double Scale2;
     int Count;
@@ -581,6 +609,20 @@ struct GetterFuncPtr {
     const int Count;
 };
 
+// Interprets the points of a ring buffer, see ImPlotStreamSeries
+struct GetterStream {
+    GetterStream(const ImPlotStreamSeries::_Slot* slots, int size, int first, int count) : Slots(slots), Size(size), First(first), Count(count) { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        const int i = First + (int)idx;
+        const ImPlotStreamSeries::_Slot& slot = Slots[i < Size ? i : i - Size];
+        return ImPlotPoint(slot.X.load(std::memory_order_relaxed), slot.Y.load(std::memory_order_relaxed));
+    }
+    const ImPlotStreamSeries::_Slot* const Slots;
+    const int Size;
+    const int First;
+    const int Count;
+};
+
 template <typename _Getter>
 struct GetterOverrideX {
     GetterOverrideX(_Getter getter, double x) : Getter(getter), X(x), Count(getter.Count) { }
@@ -768,18 +810,47 @@ struct FitterRect {
     const ImPlotPoint Pmax;
 };
 
+// Fits the bounds maintained by a stream, scanning the points on axes with ImPlotAxisFlags_RangeFit or constraints
+// rejecting the bounds (e.g. <= 0 on a log scale)
+struct FitterStream {
+    FitterStream(const GetterStream& getter, const ImPlotRect& bounds) : Getter(getter), Bounds(bounds) { }
+    void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
+        if (ImHasFlag(x_axis.Flags, ImPlotAxisFlags_RangeFit) || ImHasFlag(y_axis.Flags, ImPlotAxisFlags_RangeFit)) {
+            Fitter1<GetterStream>(Getter).Fit(x_axis, y_axis);
+            return;
+        }
+        if (Bounds.X.Min > Bounds.X.Max || (x_axis.ConstraintRange.Contains(Bounds.X.Min) && x_axis.ConstraintRange.Contains(Bounds.X.Max))) {
+            x_axis.ExtendFit(Bounds.X.Min);
+            x_axis.ExtendFit(Bounds.X.Max);
+        }
+        else {
+            FitterX<GetterStream>(Getter).Fit(x_axis, y_axis);
+        }
+        if (Bounds.Y.Min > Bounds.Y.Max || (y_axis.ConstraintRange.Contains(Bounds.Y.Min) && y_axis.ConstraintRange.Contains(Bounds.Y.Max))) {
+            y_axis.ExtendFit(Bounds.Y.Min);
+            y_axis.ExtendFit(Bounds.Y.Max);
+        }
+        else {
+            FitterY<GetterStream>(Getter).Fit(x_axis, y_axis);
+        }
+    }
+    const GetterStream& Getter;
+    const ImPlotRect Bounds;
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Transformers
 //-----------------------------------------------------------------------------
 
 struct Transformer1 {
-    Transformer1(double pixMin, double pltMin, double pltMax, double m, double scaMin, double scaMax, ImPlotTransform fwd, void* data) :
+    Transformer1(double pixMin, double pltMin, double pltMax, double m, double scaMin, double scaMax, ImPlotScale scale, ImPlotTransform fwd, void* data) :
         ScaMin(scaMin),
         ScaMax(scaMax),
         PltMin(pltMin),
         PltMax(pltMax),
         PixMin(pixMin),
         M(m),
+        Scale(scale),
         TransformFwd(fwd),
         TransformData(data)
     { }
@@ -793,7 +864,34 @@ struct Transformer1 {
         return (float)(PixMin + M * (p - PltMin));
     }
 
+    // Transforms count values with one loop per scale instead of a branch and an indirect call per value
+    void Transform(const double* plt, float* pix, int count) const {
+        if (TransformFwd == nullptr) {
+            for (int i = 0; i < count; ++i)
+                pix[i] = (float)(PixMin + M * (plt[i] - PltMin));
+        }
+        else if (Scale == ImPlotScale_Log10) {
+            for (int i = 0; i < count; ++i)
+                pix[i] = FromScale(TransformForward_Log10(plt[i], nullptr));
+        }
+        else if (Scale == ImPlotScale_SymLog) {
+            for (int i = 0; i < count; ++i)
+                pix[i] = FromScale(TransformForward_SymLog(plt[i], nullptr));
+        }
+        else {
+            for (int i = 0; i < count; ++i)
+                pix[i] = FromScale(TransformFwd(plt[i], TransformData));
+        }
+    }
+
+    IMPLOT_INLINE float FromScale(double s) const {
+        double t = (s - ScaMin) / (ScaMax - ScaMin);
+        double p = PltMin + (PltMax - PltMin) * t;
+        return (float)(PixMin + M * (p - PltMin));
+    }
+
     double ScaMin, ScaMax, PltMin, PltMax, PixMin, M;
+    ImPlotScale     Scale;
     ImPlotTransform TransformFwd;
     void*           TransformData;
 };
@@ -806,6 +904,7 @@ struct Transformer2 {
            x_axis.ScaleToPixel,
            x_axis.ScaleMin,
            x_axis.ScaleMax,
+           x_axis.Scale,
            x_axis.TransformForward,
            x_axis.TransformData),
         Ty(y_axis.PixelMin,
@@ -814,6 +913,7 @@ struct Transformer2 {
            y_axis.ScaleToPixel,
            y_axis.ScaleMin,
            y_axis.ScaleMax,
+           y_axis.Scale,
            y_axis.TransformForward,
            y_axis.TransformData)
     { }
@@ -844,6 +944,328 @@ struct Transformer2 {
     Transformer1 Ty;
 };
 
+// Fetches points from a getter and transforms them to pixels a block at a time, so renderers read pixels from SoA
+// arrays filled by streaming passes instead of transforming each point on its own. Points are read in increasing order.
+template <class _Getter>
+struct TransformerBatch {
+    TransformerBatch(const _Getter& getter, const Transformer2& transformer) :
+        Getter(getter),
+        Transformer(transformer),
+        Begin(0),
+        End(0)
+    { }
+
+    IMPLOT_INLINE ImVec2 operator()(int idx) const {
+        if (idx < Begin || idx >= End)
+            Fetch(idx);
+        return ImVec2(PixX[idx - Begin], PixY[idx - Begin]);
+    }
+
+    void Fetch(int idx) const {
+        Begin = idx;
+        End   = ImMax(ImMin(idx + IMPLOT_TRANSFORM_BATCH_SIZE, Getter.Count), idx + 1);
+        const int count = End - Begin;
+        const Transformer1& tx = Transformer.Tx;
+        const Transformer1& ty = Transformer.Ty;
+        // linear scales are transformed while fetching, without going through PltX and PltY
+        if (tx.TransformFwd == nullptr && ty.TransformFwd == nullptr) {
+            for (int i = 0; i < count; ++i) {
+                const ImPlotPoint p = Getter(Begin + i);
+                PixX[i] = (float)(tx.PixMin + tx.M * (p.x - tx.PltMin));
+                PixY[i] = (float)(ty.PixMin + ty.M * (p.y - ty.PltMin));
+            }
+            return;
+        }
+        for (int i = 0; i < count; ++i) {
+            const ImPlotPoint p = Getter(Begin + i);
+            PltX[i] = p.x;
+            PltY[i] = p.y;
+        }
+        tx.Transform(PltX, PixX, count);
+        ty.Transform(PltY, PixY, count);
+    }
+
+    const _Getter& Getter;
+    const Transformer2& Transformer;
+    mutable int Begin, End;
+    mutable double PltX[IMPLOT_TRANSFORM_BATCH_SIZE], PltY[IMPLOT_TRANSFORM_BATCH_SIZE];
+    mutable float PixX[IMPLOT_TRANSFORM_BATCH_SIZE], PixY[IMPLOT_TRANSFORM_BATCH_SIZE];
+};
+
+//-----------------------------------------------------------------------------
+// [SECTION] Downsampling
+//-----------------------------------------------------------------------------
+
+// Interprets a buffer of ImPlotPoints, e.g. the output of a downsampler
+struct GetterPoints {
+    GetterPoints(const ImPlotPoint* points, int count) : Points(points), Count(count) { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        return Points[idx];
+    }
+    const ImPlotPoint* const Points;
+    const int Count;
+};
+
+// First, min, max and last points of a pixel column
+struct DownsampleColumn {
+    DownsampleColumn() : Col(0), IdxFirst(0), IdxMin(0), IdxMax(0), IdxLast(-1) { }
+    IMPLOT_INLINE bool IsEmpty() const { return IdxLast < 0; }
+    IMPLOT_INLINE void Begin(int col, int idx, const ImPlotPoint& p) {
+        Col = col;
+        IdxFirst = IdxMin = IdxMax = IdxLast = idx;
+        First = Min = Max = Last = p;
+    }
+    IMPLOT_INLINE void Add(int idx, const ImPlotPoint& p) {
+        if (p.y < Min.y) { Min = p; IdxMin = idx; }
+        if (p.y > Max.y) { Max = p; IdxMax = idx; }
+        Last = p; IdxLast = idx;
+    }
+    // Append the distinct points in their original order
+    void Flush(ImVector<ImPlotPoint>& out) {
+        if (IsEmpty())
+            return;
+        out.push_back(First);
+        const bool min_inner = IdxMin != IdxFirst && IdxMin != IdxLast;
+        const bool max_inner = IdxMax != IdxFirst && IdxMax != IdxLast;
+        if (min_inner && (!max_inner || IdxMin < IdxMax)) out.push_back(Min);
+        if (max_inner)                                    out.push_back(Max);
+        if (min_inner && max_inner && IdxMin > IdxMax)    out.push_back(Min);
+        if (IdxLast != IdxFirst)                          out.push_back(Last);
+        IdxLast = -1;
+    }
+    int Col, IdxFirst, IdxMin, IdxMax, IdxLast;
+    ImPlotPoint First, Min, Max, Last;
+};
+
+// Reduces a series to the first, min, max and last points of each pixel column. Segments joining the points of a column
+// lie within the column's vertical extent, so the rendered line covers the same pixels as with all points. Points left
+// and right of the plot are gathered in one column on each side. Returns false if x isn't monotonic.
+template <typename _Getter>
+bool DownsampleMinMax(const _Getter& getter, const Transformer1& tx, float pix_min, float pix_max, bool skip_nan, ImVector<ImPlotPoint>& out) {
+    out.resize(0);
+    const int dir = tx(getter(getter.Count - 1).x) >= tx(getter(0).x) ? 1 : -1;
+    const int col_lo = (int)ImFloor(pix_min) - 1;
+    const int col_hi = (int)ImFloor(pix_max) + 1;
+    DownsampleColumn column;
+    for (int i = 0; i < getter.Count; ++i) {
+        const ImPlotPoint p = getter(i);
+        if (ImNan(p.x) || ImNan(p.y)) {
+            if (skip_nan)
+                continue;
+            // keep the gap in the line
+            column.Flush(out);
+            out.push_back(p);
+            continue;
+        }
+        const int col = ImClamp((int)ImFloor(tx(p.x)), col_lo, col_hi);
+        if (!column.IsEmpty() && col == column.Col) {
+            column.Add(i, p);
+            continue;
+        }
+        if (!column.IsEmpty() && (col - column.Col) * dir < 0)
+            return false;
+        column.Flush(out);
+        column.Begin(col, i, p);
+    }
+    column.Flush(out);
+    return true;
+}
+
+// Largest-Triangle-Three-Buckets (S. Steinarsson, 2013): keeps the first and last points and, in each of threshold-2 buckets,
+// the point forming the largest triangle with the point kept from the previous bucket and the average of the next bucket.
+// Only the visible x range and one point on each side are reduced, NaNs are skipped. Returns false if x isn't monotonic.
+template <typename _Getter>
+bool DownsampleLTTB(const _Getter& getter, const Transformer1& tx, float pix_min, float pix_max, int threshold, ImVector<ImPlotPoint>& out) {
+    out.resize(0);
+    const int dir = tx(getter(getter.Count - 1).x) >= tx(getter(0).x) ? 1 : -1;
+    const float key_min = dir > 0 ? pix_min : -pix_max;
+    const float key_max = dir > 0 ? pix_max : -pix_min;
+    int first = 0, last = getter.Count - 1;
+    float prev_key = -FLT_MAX;
+    for (int i = 0; i < getter.Count; ++i) {
+        const double x = getter(i).x;
+        if (ImNan(x))
+            continue;
+        const float key = tx(x) * dir;
+        if (key < prev_key)
+            return false;
+        prev_key = key;
+        if (key < key_min)
+            first = i;
+        else if (key > key_max && last == getter.Count - 1)
+            last = i;
+    }
+
+    const int count = last - first + 1;
+    if (count <= threshold || threshold < 3) {
+        for (int i = first; i <= last; ++i)
+            out.push_back(getter(i));
+        return true;
+    }
+    out.reserve(threshold);
+    out.push_back(getter(first));
+    ImPlotPoint a = getter(first);
+    const double bucket_size = (double)(count - 2) / (threshold - 2);
+    for (int bucket = 0; bucket < threshold - 2; ++bucket) {
+        const int range_begin = first + 1 + (int)(bucket * bucket_size);
+        const int range_end   = first + 1 + (int)((bucket + 1) * bucket_size);
+        const int next_end    = ImMin(first + 1 + (int)((bucket + 2) * bucket_size), last + 1);
+        // average of the next bucket
+        ImPlotPoint avg(0, 0);
+        int avg_count = 0;
+        for (int i = range_end; i < next_end; ++i) {
+            const ImPlotPoint p = getter(i);
+            if (ImNan(p.x) || ImNan(p.y))
+                continue;
+            avg.x += p.x;
+            avg.y += p.y;
+            avg_count++;
+        }
+        if (avg_count > 0) {
+            avg.x /= avg_count;
+            avg.y /= avg_count;
+        }
+        else {
+            avg = getter(last);
+        }
+        // point of this bucket with the largest triangle
+        double max_area = -1;
+        ImPlotPoint picked;
+        for (int i = range_begin; i < range_end; ++i) {
+            const ImPlotPoint p = getter(i);
+            const double area = ImAbs((a.x - avg.x) * (p.y - a.y) - (a.x - p.x) * (avg.y - a.y));
+            if (area > max_area) { // false for NaNs
+                max_area = area;
+                picked = p;
+            }
+        }
+        if (max_area >= 0) {
+            out.push_back(picked);
+            a = picked;
+        }
+    }
+    out.push_back(getter(last));
+    return true;
+}
+
+// Downsamples a line or stairs series to the resolution of the current plot when it has many more points than the plot is
+// wide. Returns false if the series should be rendered as is.
+template <typename _Getter>
+bool Downsample(const _Getter& getter, bool lttb, bool skip_nan, ImVector<ImPlotPoint>& out) {
+    const ImPlotPlot& plot = *GImPlot->CurrentPlot;
+    const float width = ImMax(plot.PlotRect.GetWidth(), 1.0f);
+    if (getter.Count <= IMPLOT_DOWNSAMPLE_POINTS_PER_PIXEL * width)
+        return false;
+    const Transformer1 tx = Transformer2(plot).Tx;
+    if (lttb)
+        return DownsampleLTTB(getter, tx, plot.PlotRect.Min.x, plot.PlotRect.Max.x, 2 * (int)width, out);
+    return DownsampleMinMax(getter, tx, plot.PlotRect.Min.x, plot.PlotRect.Max.x, skip_nan, out);
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] Cached Series
+//-----------------------------------------------------------------------------
+
+// Interprets an ImPlotSeries
+struct GetterSeries {
+    GetterSeries(const ImPlotSeries& series) : Series(series), Count(series.Size()) { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        return ImPlotPoint(Series.GetX((int)idx), Series.GetY((int)idx));
+    }
+    const ImPlotSeries& Series;
+    const int Count;
+};
+
+// Fits x to the first and last points and y to the extremes found in the pyramid. Series with non-monotonic x, or fitted
+// with ImPlotAxisFlags_RangeFit on the x axis, are scanned in full.
+struct FitterSeries {
+    FitterSeries(const ImPlotSeries& series) : Series(series) { }
+    void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
+        if (!Series.XMonotonic || ImHasFlag(x_axis.Flags, ImPlotAxisFlags_RangeFit)) {
+            GetterSeries getter(Series);
+            Fitter1<GetterSeries>(getter).Fit(x_axis, y_axis);
+            return;
+        }
+        const int x_first = Series.LowerBound(x_axis.ConstraintRange.Min);
+        const int x_last  = Series.UpperBound(x_axis.ConstraintRange.Max);
+        if (x_first < x_last) {
+            x_axis.ExtendFit(Series.GetX(x_first));
+            x_axis.ExtendFit(Series.GetX(x_last - 1));
+        }
+        // with ImPlotAxisFlags_RangeFit, y is only fitted to the points in the visible x range
+        int first = 0, last = Series.Size();
+        if (ImHasFlag(y_axis.Flags, ImPlotAxisFlags_RangeFit)) {
+            first = Series.LowerBound(x_axis.Range.Min);
+            last  = Series.UpperBound(x_axis.Range.Max);
+        }
+        int idx_min, idx_max;
+        if (!Series.FindMinMax(first, last, &idx_min, &idx_max))
+            return;
+        const double y_min = Series.GetY(idx_min);
+        const double y_max = Series.GetY(idx_max);
+        if (!ImNanOrInf(y_min) && !ImNanOrInf(y_max) && y_min >= y_axis.ConstraintRange.Min && y_max <= y_axis.ConstraintRange.Max) {
+            y_axis.ExtendFit(y_min);
+            y_axis.ExtendFit(y_max);
+        }
+        else {
+            // an extreme is rejected by the axis (e.g. <= 0 on a log scale), look for the values it accepts
+            for (int i = first; i < last; ++i)
+                y_axis.ExtendFit(Series.GetY(i));
+        }
+    }
+    const ImPlotSeries& Series;
+};
+
+// Gets the points of a series in the visible x range of the current plot, and one point on each side. When reducing and
+// there are many more points than pixels, only the first, min, max and last points of each pixel column are kept, found
+// with the pyramid so that the cost depends on the plot width. Returns false if x isn't monotonic.
+bool GetSeriesPoints(const ImPlotSeries& series, bool reduce, ImVector<ImPlotPoint>& out) {
+    out.resize(0);
+    if (!series.XMonotonic)
+        return false;
+    const ImPlotPlot& plot = *GImPlot->CurrentPlot;
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const int col_first = (int)ImFloor(plot.PlotRect.Min.x);
+    const int col_count = ImMax((int)ImCeil(plot.PlotRect.Max.x) - col_first, 1);
+    const double x_left  = x_axis.PixelsToPlot((float)col_first);
+    const double x_right = x_axis.PixelsToPlot((float)(col_first + col_count));
+    const bool inverted = x_left > x_right;
+    const int first = ImMax(series.LowerBound(inverted ? x_right : x_left) - 1, 0);
+    const int last  = ImMin(series.UpperBound(inverted ? x_left : x_right) + 1, series.Size());
+    if (!reduce || last - first <= IMPLOT_DOWNSAMPLE_POINTS_PER_PIXEL * col_count) {
+        out.reserve(last - first);
+        for (int i = first; i < last; ++i)
+            out.push_back(ImPlotPoint(series.GetX(i), series.GetY(i)));
+        return true;
+    }
+    // walk the columns in ascending x, the outer columns also take the points beyond the plot
+    out.reserve(4 * col_count + 2);
+    int begin = first;
+    for (int col = 0; col < col_count && begin < last; ++col) {
+        int end = last;
+        if (col < col_count - 1) {
+            const float pix = (float)(inverted ? col_first + col_count - 1 - col : col_first + col + 1);
+            end = ImClamp(series.LowerBound(x_axis.PixelsToPlot(pix)), begin, last);
+        }
+        if (begin == end)
+            continue;
+        int idx[4] = { begin, -1, -1, end - 1 };
+        series.FindMinMax(begin, end, &idx[1], &idx[2]);
+        if (idx[1] > idx[2])
+            ImSwap(idx[1], idx[2]);
+        int prev = -1;
+        for (int k = 0; k < 4; ++k) {
+            // min and max are -1 in a column of NaNs, the others are in ascending order
+            if (idx[k] > prev) {
+                out.push_back(ImPlotPoint(series.GetX(idx[k]), series.GetY(idx[k])));
+                prev = idx[k];
+            }
+        }
+        begin = end;
+    }
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Renderers
 //-----------------------------------------------------------------------------
@@ -865,16 +1287,17 @@ struct RendererLineStrip : RendererBase {
     RendererLineStrip(const _Getter& getter, ImU32 col, float weight) :
         RendererBase(getter.Count - 1, 6, 4),
         Getter(getter),
+        Points(getter, this->Transformer),
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(0);
     }
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
             return false;
@@ -884,6 +1307,7 @@ struct RendererLineStrip : RendererBase {
         return true;
     }
     const _Getter& Getter;
+    TransformerBatch<_Getter> Points;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 P1;
@@ -896,16 +1320,17 @@ struct RendererLineStripSkip : RendererBase {
     RendererLineStripSkip(const _Getter& getter, ImU32 col, float weight) :
         RendererBase(getter.Count - 1, 6, 4),
         Getter(getter),
+        Points(getter, this->Transformer),
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(0);
     }
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             if (!ImNan(P2.x) && !ImNan(P2.y))
                 P1 = P2;
@@ -917,6 +1342,7 @@ struct RendererLineStripSkip : RendererBase {
         return true;
     }
     const _Getter& Getter;
+    TransformerBatch<_Getter> Points;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 P1;
@@ -929,6 +1355,7 @@ struct RendererLineSegments1 : RendererBase {
     RendererLineSegments1(const _Getter& getter, ImU32 col, float weight) :
         RendererBase(getter.Count / 2, 6, 4),
         Getter(getter),
+        Points(getter, this->Transformer),
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     { }
@@ -936,14 +1363,15 @@ struct RendererLineSegments1 : RendererBase {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P1 = this->Transformer(Getter(prim*2+0));
-        ImVec2 P2 = this->Transformer(Getter(prim*2+1));
+        ImVec2 P1 = Points(prim*2+0);
+        ImVec2 P2 = Points(prim*2+1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
             return false;
         PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
         return true;
     }
     const _Getter& Getter;
+    TransformerBatch<_Getter> Points;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 UV0;
@@ -956,6 +1384,8 @@ struct RendererLineSegments2 : RendererBase {
         RendererBase(ImMin(getter1.Count, getter1.Count), 6, 4),
         Getter1(getter1),
         Getter2(getter2),
+        Points1(getter1, this->Transformer),
+        Points2(getter2, this->Transformer),
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {}
@@ -963,8 +1393,8 @@ struct RendererLineSegments2 : RendererBase {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P1 = this->Transformer(Getter1(prim));
-        ImVec2 P2 = this->Transformer(Getter2(prim));
+        ImVec2 P1 = Points1(prim);
+        ImVec2 P2 = Points2(prim);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
             return false;
         PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
@@ -972,6 +1402,8 @@ struct RendererLineSegments2 : RendererBase {
     }
     const _Getter1& Getter1;
     const _Getter2& Getter2;
+    TransformerBatch<_Getter1> Points1;
+    TransformerBatch<_Getter2> Points2;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 UV0;
@@ -1140,16 +1572,17 @@ struct RendererStairsPre : RendererBase {
     RendererStairsPre(const _Getter& getter, ImU32 col, float weight) :
         RendererBase(getter.Count - 1, 12, 8),
         Getter(getter),
+        Points(getter, this->Transformer),
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
             return false;
@@ -1160,6 +1593,7 @@ struct RendererStairsPre : RendererBase {
         return true;
     }
     const _Getter& Getter;
+    TransformerBatch<_Getter> Points;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 P1;
@@ -1171,16 +1605,17 @@ struct RendererStairsPost : RendererBase {
     RendererStairsPost(const _Getter& getter, ImU32 col, float weight) :
         RendererBase(getter.Count - 1, 12, 8),
         Getter(getter),
+        Points(getter, this->Transformer),
         Col(col),
         HalfWeight(ImMax(1.0f,weight) * 0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
             return false;
@@ -1191,6 +1626,7 @@ struct RendererStairsPost : RendererBase {
         return true;
     }
     const _Getter& Getter;
+    TransformerBatch<_Getter> Points;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 P1;
@@ -1202,16 +1638,17 @@ struct RendererStairsPreShaded : RendererBase {
     RendererStairsPreShaded(const _Getter& getter, ImU32 col) :
         RendererBase(getter.Count - 1, 6, 4),
         Getter(getter),
+        Points(getter, this->Transformer),
         Col(col)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(0);
         Y0 = this->Transformer(ImPlotPoint(0,0)).y;
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(prim + 1);
         ImVec2 PMin(ImMin(P1.x, P2.x), ImMin(Y0, P2.y));
         ImVec2 PMax(ImMax(P1.x, P2.x), ImMax(Y0, P2.y));
         if (!cull_rect.Overlaps(ImRect(PMin, PMax))) {
@@ -1223,6 +1660,7 @@ struct RendererStairsPreShaded : RendererBase {
         return true;
     }
     const _Getter& Getter;
+    TransformerBatch<_Getter> Points;
     const ImU32 Col;
     float Y0;
     mutable ImVec2 P1;
@@ -1234,16 +1672,17 @@ struct RendererStairsPostShaded : RendererBase {
     RendererStairsPostShaded(const _Getter& getter, ImU32 col) :
         RendererBase(getter.Count - 1, 6, 4),
         Getter(getter),
+        Points(getter, this->Transformer),
         Col(col)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(0);
         Y0 = this->Transformer(ImPlotPoint(0,0)).y;
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(prim + 1);
         ImVec2 PMin(ImMin(P1.x, P2.x), ImMin(P1.y, Y0));
         ImVec2 PMax(ImMax(P1.x, P2.x), ImMax(P1.y, Y0));
         if (!cull_rect.Overlaps(ImRect(PMin, PMax))) {
@@ -1255,6 +1694,7 @@ struct RendererStairsPostShaded : RendererBase {
         return true;
     }
     const _Getter& Getter;
+    TransformerBatch<_Getter> Points;
     const ImU32 Col;
     float Y0;
     mutable ImVec2 P1;
@@ -1269,17 +1709,19 @@ struct RendererShaded : RendererBase {
         RendererBase(ImMin(getter1.Count, getter2.Count) - 1, 6, 5),
         Getter1(getter1),
         Getter2(getter2),
+        Points1(getter1, this->Transformer),
+        Points2(getter2, this->Transformer),
         Col(col)
     {
-        P11 = this->Transformer(Getter1(0));
-        P12 = this->Transformer(Getter2(0));
+        P11 = Points1(0);
+        P12 = Points2(0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P21 = this->Transformer(Getter1(prim+1));
-        ImVec2 P22 = this->Transformer(Getter2(prim+1));
+        ImVec2 P21 = Points1(prim+1);
+        ImVec2 P22 = Points2(prim+1);
         ImRect rect(ImMin(ImMin(ImMin(P11,P12),P21),P22), ImMax(ImMax(ImMax(P11,P12),P21),P22));
         if (!cull_rect.Overlaps(rect)) {
             P11 = P21;
@@ -1318,6 +1760,8 @@ struct RendererShaded : RendererBase {
     }
     const _Getter1& Getter1;
     const _Getter2& Getter2;
+    TransformerBatch<_Getter1> Points1;
+    TransformerBatch<_Getter2> Points2;
     const ImU32 Col;
     mutable ImVec2 P11;
     mutable ImVec2 P12;
@@ -1352,6 +1796,248 @@ struct RendererRectC : RendererBase {
     mutable ImVec2 UV;
 };
 
+//-----------------------------------------------------------------------------
+// [SECTION] Parallel Rendering
+//-----------------------------------------------------------------------------
+
+// Placeholder of a deferred item in its draw list, replaced by the item's geometry in EndParallelRender()
+static void RenderJobCallback(const ImDrawList*, const ImDrawCmd*) { }
+
+// Returns true if the geometry of an item rendered to draw_list can be deferred. The channels of a split draw list share
+// its vertex buffer, so they are rendered to immediately.
+static inline bool CanDeferRender(const ImDrawList& draw_list) {
+    const ImPlotContext& gp = *GImPlot;
+    return gp.ParallelRender > 0 && gp.ParallelRenderLock == 0 && draw_list._Splitter._Count <= 1;
+}
+
+// Records a job and leaves its placeholder in draw_list
+static void DeferRender(ImPlotRenderJob* job, ImDrawList& draw_list, const ImRect& cull_rect) {
+    job->DrawList = &draw_list;
+    job->Header   = draw_list._CmdHeader;
+    job->CullRect = cull_rect;
+    job->VtxCut   = draw_list.VtxBuffer.Size;
+    draw_list.AddCallback(RenderJobCallback, job);
+    GImPlot->RenderJobs.push_back(job);
+}
+
+// Returns the buffer an item downsamples its points to, which must outlive the item when its rendering is deferred
+static ImVector<ImPlotPoint>& GetItemPoints() {
+    ImPlotContext& gp = *GImPlot;
+    if (!CanDeferRender(*GetPlotDrawList()))
+        return gp.TempPoints;
+    if (gp.RenderPointsUsed == gp.RenderPoints.Size)
+        gp.RenderPoints.push_back(IM_NEW(ImVector<ImPlotPoint>)());
+    return *gp.RenderPoints[gp.RenderPointsUsed++];
+}
+
+// Runs func for every task, through the ParallelFor callback if there is one and more than one task
+static void RenderParallelFor(int count, void (*func)(int, void*), void* data) {
+    if (GImPlot->ParallelFor != nullptr && count > 1)
+        GImPlot->ParallelFor(count, func, data);
+    else {
+        for (int i = 0; i < count; ++i)
+            func(i, data);
+    }
+}
+
+static void RenderJobTask(int index, void* user_data) {
+    ((ImPlotRenderJob**)user_data)[index]->Render();
+}
+
+static void RenderCopyTask(int index, void* user_data) {
+    const ImPlotRenderCopy& copy = ((const ImPlotRenderCopy*)user_data)[index];
+    if (!copy.Indices)
+        memcpy(copy.Dst, copy.Src, copy.Count * sizeof(ImDrawVert));
+    else if (copy.Rebase == 0)
+        memcpy(copy.Dst, copy.Src, copy.Count * sizeof(ImDrawIdx));
+    else {
+        const ImDrawIdx* src = (const ImDrawIdx*)copy.Src;
+        ImDrawIdx* dst = (ImDrawIdx*)copy.Dst;
+        for (int i = 0; i < copy.Count; ++i)
+            dst[i] = (ImDrawIdx)(src[i] + copy.Rebase);
+    }
+}
+
+// Queues a copy, split in tasks of at most IMPLOT_RENDER_COPY_SIZE elements
+static void AddRenderCopy(ImVector<ImPlotRenderCopy>& copies, const void* src, void* dst, int count, unsigned int rebase, bool indices) {
+    const int size = indices ? (int)sizeof(ImDrawIdx) : (int)sizeof(ImDrawVert);
+    for (int i = 0; i < count; i += IMPLOT_RENDER_COPY_SIZE) {
+        ImPlotRenderCopy copy;
+        copy.Src     = (const char*)src + i * size;
+        copy.Dst     = (char*)dst + i * size;
+        copy.Count   = ImMin(count - i, IMPLOT_RENDER_COPY_SIZE);
+        copy.Rebase  = rebase;
+        copy.Indices = indices;
+        copies.push_back(copy);
+    }
+}
+
+// Returns the number of shard vertices inserted before the vertex vtx of a draw list, including those inserted at vtx
+// when inclusive is set
+static int RenderJobShift(ImPlotRenderJob* const* jobs, int count, int vtx, bool inclusive) {
+    int lo = 0, hi = count;
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        if (jobs[mid]->VtxCut < vtx || (inclusive && jobs[mid]->VtxCut == vtx))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo > 0 ? jobs[lo - 1]->VtxShift : 0;
+}
+
+// Appends count indices to a merged command list, where index 0 is the merged vertex vtx_start. With join set, the last
+// command is continued if its header matches, as it would have been by ImDrawList.
+static void MergeDrawCmd(ImVector<ImDrawCmd>& cmds, ImDrawIdx*& idx_write, const ImDrawIdx* idx_data, const ImDrawCmd& header, unsigned int vtx_offset, unsigned int vtx_start, const ImDrawIdx* idx, unsigned int count, bool join) {
+    if (sizeof(ImDrawIdx) < 4) {
+        unsigned int idx_max = 0;
+        for (unsigned int i = 0; i < count; ++i)
+            idx_max = ImMax(idx_max, (unsigned int)idx[i]);
+        if (vtx_start - vtx_offset + idx_max > MaxIdx<ImDrawIdx>::Value)
+            vtx_offset = vtx_start;
+    }
+    ImDrawCmd* cmd = cmds.Size > 0 ? &cmds.back() : nullptr;
+    if (!join || cmd == nullptr || cmd->UserCallback != nullptr || cmd->VtxOffset != vtx_offset || cmd->TextureId != header.TextureId || memcmp(&cmd->ClipRect, &header.ClipRect, sizeof(ImVec4)) != 0) {
+        cmds.push_back(ImDrawCmd());
+        cmd = &cmds.back();
+        cmd->ClipRect  = header.ClipRect;
+        cmd->TextureId = header.TextureId;
+        cmd->VtxOffset = vtx_offset;
+        cmd->IdxOffset = (unsigned int)(idx_write - idx_data);
+    }
+    AddRenderCopy(GImPlot->MergeCopies, idx, idx_write, (int)count, vtx_start - cmd->VtxOffset, true);
+    idx_write += count;
+    cmd->ElemCount += count;
+}
+
+// Splices the shards of the jobs of a draw list in place of their placeholders. The jobs are in submission order.
+static void MergeRenderJobs(ImDrawList& draw_list, ImPlotRenderJob* const* jobs, int count) {
+    ImPlotContext& gp = *GImPlot;
+    ImVector<ImPlotRenderCopy>& copies = gp.MergeCopies;
+    copies.resize(0);
+    int vtx_count = draw_list.VtxBuffer.Size;
+    int idx_count = draw_list.IdxBuffer.Size;
+    for (int j = 0; j < count; ++j) {
+        vtx_count += jobs[j]->Shard->VtxBuffer.Size;
+        idx_count += jobs[j]->Shard->IdxBuffer.Size;
+    }
+    // each shard's vertices are inserted where the vertex buffer ended when its item was submitted
+    ImVector<ImDrawVert>& vtx = gp.MergeVtx;
+    vtx.resize(vtx_count);
+    int vtx_read = 0, vtx_write = 0;
+    for (int j = 0; j < count; ++j) {
+        ImPlotRenderJob& job = *jobs[j];
+        const ImVector<ImDrawVert>& shard_vtx = job.Shard->VtxBuffer;
+        AddRenderCopy(copies, draw_list.VtxBuffer.Data + vtx_read, vtx.Data + vtx_write, job.VtxCut - vtx_read, 0, false);
+        vtx_write  += job.VtxCut - vtx_read;
+        vtx_read    = job.VtxCut;
+        job.VtxBase = vtx_write;
+        AddRenderCopy(copies, shard_vtx.Data, vtx.Data + vtx_write, shard_vtx.Size, 0, false);
+        vtx_write  += shard_vtx.Size;
+        job.VtxShift = vtx_write - vtx_read;
+    }
+    AddRenderCopy(copies, draw_list.VtxBuffer.Data + vtx_read, vtx.Data + vtx_write, draw_list.VtxBuffer.Size - vtx_read, 0, false);
+    // a shard continues the command before its placeholder and the command after the placeholder continues the shard, so
+    // that the commands are those ImDrawList would have made for the items rendered in order
+    ImVector<ImDrawIdx>& idx = gp.MergeIdx;
+    ImVector<ImDrawCmd>& cmds = gp.MergeCmd;
+    idx.resize(idx_count);
+    cmds.resize(0);
+    ImDrawIdx* idx_write = idx.Data;
+    bool join = false;
+    for (int c = 0; c < draw_list.CmdBuffer.Size; ++c) {
+        const ImDrawCmd& cmd = draw_list.CmdBuffer[c];
+        const unsigned int vtx_offset = cmd.VtxOffset + RenderJobShift(jobs, count, cmd.VtxOffset, false);
+        if (cmd.UserCallback == RenderJobCallback) {
+            const ImPlotRenderJob& job = *(const ImPlotRenderJob*)cmd.UserCallbackData;
+            const ImDrawList& shard = *job.Shard;
+            for (int s = 0; s < shard.CmdBuffer.Size; ++s) {
+                const ImDrawCmd& shard_cmd = shard.CmdBuffer[s];
+                if (shard_cmd.ElemCount > 0)
+                    MergeDrawCmd(cmds, idx_write, idx.Data, cmd, vtx_offset, job.VtxBase + shard_cmd.VtxOffset, shard.IdxBuffer.Data + shard_cmd.IdxOffset, shard_cmd.ElemCount, true);
+            }
+            join = true;
+        }
+        else if (cmd.UserCallback != nullptr) {
+            cmds.push_back(cmd);
+            cmds.back().VtxOffset = vtx_offset;
+            cmds.back().IdxOffset = (unsigned int)(idx_write - idx.Data);
+            join = false;
+        }
+        else {
+            // the vertices of a command are all between the same two placeholders
+            const ImDrawIdx* cmd_idx = draw_list.IdxBuffer.Data + cmd.IdxOffset;
+            const unsigned int vtx_start = cmd.ElemCount > 0 ? cmd.VtxOffset + RenderJobShift(jobs, count, cmd.VtxOffset + cmd_idx[0], true) : vtx_offset;
+            MergeDrawCmd(cmds, idx_write, idx.Data, cmd, vtx_offset, vtx_start, cmd_idx, cmd.ElemCount, join);
+            join = false;
+        }
+    }
+    IM_ASSERT(idx_write == idx.Data + idx_count);
+    RenderParallelFor(copies.Size, RenderCopyTask, copies.Data);
+    draw_list.VtxBuffer.swap(vtx);
+    draw_list.IdxBuffer.swap(idx);
+    draw_list.CmdBuffer.swap(cmds);
+    draw_list._VtxWritePtr = draw_list.VtxBuffer.Data + draw_list.VtxBuffer.Size;
+    draw_list._IdxWritePtr = draw_list.IdxBuffer.Data + draw_list.IdxBuffer.Size;
+    draw_list._CmdHeader.VtxOffset = draw_list.CmdBuffer.back().VtxOffset;
+    draw_list._VtxCurrentIdx = (unsigned int)draw_list.VtxBuffer.Size - draw_list._CmdHeader.VtxOffset;
+    if (draw_list._VtxCurrentIdx > MaxIdx<ImDrawIdx>::Value) {
+        draw_list._CmdHeader.VtxOffset = draw_list.VtxBuffer.Size;
+        draw_list._OnChangedVtxOffset();
+    }
+}
+
+void BeginParallelRender() {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    GImPlot->ParallelRender++;
+}
+
+void EndParallelRender() {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.ParallelRender > 0, "Mismatched BeginParallelRender()/EndParallelRender()!");
+    if (--gp.ParallelRender > 0)
+        return;
+    ImVector<ImPlotRenderJob*>& jobs = gp.RenderJobs;
+    // shards keep their buffers between frames, and are reserved here so that workers don't allocate
+    while (gp.RenderShards.Size < jobs.Size)
+        gp.RenderShards.push_back(IM_NEW(ImDrawList)(jobs[0]->DrawList->_Data));
+    for (int j = 0; j < jobs.Size; ++j) {
+        ImPlotRenderJob& job = *jobs[j];
+        ImDrawList& shard = *gp.RenderShards[j];
+        shard._Data = job.DrawList->_Data;
+        shard._ResetForNewFrame();
+        shard.Flags = job.DrawList->Flags;
+        shard.PushClipRect(ImVec2(job.Header.ClipRect.x, job.Header.ClipRect.y), ImVec2(job.Header.ClipRect.z, job.Header.ClipRect.w));
+        shard.PushTextureID(job.Header.TextureId);
+        shard.VtxBuffer.reserve(job.VtxReserve);
+        shard.IdxBuffer.reserve(job.IdxReserve);
+        shard.CmdBuffer.reserve(2 + job.VtxReserve / (MaxIdx<ImDrawIdx>::Value / 2));
+        job.Shard = &shard;
+    }
+    RenderParallelFor(jobs.Size, RenderJobTask, jobs.Data);
+    // merge the jobs of each draw list, e.g. those of child windows
+    ImVector<ImPlotRenderJob*> list_jobs;
+    for (int j = 0; j < jobs.Size; ++j) {
+        ImDrawList* draw_list = jobs[j]->DrawList;
+        if (draw_list == nullptr)
+            continue;
+        list_jobs.resize(0);
+        for (int k = j; k < jobs.Size; ++k) {
+            if (jobs[k]->DrawList == draw_list)
+                list_jobs.push_back(jobs[k]);
+        }
+        IM_ASSERT_USER_ERROR(draw_list->_Splitter._Count <= 1, "Draw list channels must be merged before EndParallelRender()!");
+        MergeRenderJobs(*draw_list, list_jobs.Data, list_jobs.Size);
+        for (int k = 0; k < list_jobs.Size; ++k)
+            list_jobs[k]->DrawList = nullptr;
+    }
+    for (int j = 0; j < jobs.Size; ++j)
+        IM_DELETE(jobs[j]);
+    jobs.resize(0);
+    gp.RenderPointsUsed = 0;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] RenderPrimitives
 //-----------------------------------------------------------------------------
@@ -1396,18 +2082,53 @@ void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const
         draw_list.PrimUnreserve(prims_culled * renderer.IdxConsumed, prims_culled * renderer.VtxConsumed);
 }
 
+// Deferred RenderPrimitives1, the renderer is made when the item is submitted so that it has the plot's transforms
+template <template <class> class _Renderer, class _Getter, typename ...Args>
+struct RenderJob1 : ImPlotRenderJob {
+    RenderJob1(const _Getter& getter, Args... args) : Getter(getter), Renderer(Getter, args...) {
+        VtxReserve = ImMax(Renderer.Prims, 0) * Renderer.VtxConsumed;
+        IdxReserve = ImMax(Renderer.Prims, 0) * Renderer.IdxConsumed;
+    }
+    void Render() override { RenderPrimitivesEx(Renderer, *Shard, CullRect); }
+    const _Getter Getter;
+    const _Renderer<_Getter> Renderer;
+};
+
+// Deferred RenderPrimitives2
+template <template <class,class> class _Renderer, class _Getter1, class _Getter2, typename ...Args>
+struct RenderJob2 : ImPlotRenderJob {
+    RenderJob2(const _Getter1& getter1, const _Getter2& getter2, Args... args) : Getter1(getter1), Getter2(getter2), Renderer(Getter1, Getter2, args...) {
+        VtxReserve = ImMax(Renderer.Prims, 0) * Renderer.VtxConsumed;
+        IdxReserve = ImMax(Renderer.Prims, 0) * Renderer.IdxConsumed;
+    }
+    void Render() override { RenderPrimitivesEx(Renderer, *Shard, CullRect); }
+    const _Getter1 Getter1;
+    const _Getter2 Getter2;
+    const _Renderer<_Getter1,_Getter2> Renderer;
+};
+
 template <template <class> class _Renderer, class _Getter, typename ...Args>
 void RenderPrimitives1(const _Getter& getter, Args... args) {
     ImDrawList& draw_list = *GetPlotDrawList();
     const ImRect& cull_rect = GetCurrentPlot()->PlotRect;
-    RenderPrimitivesEx(_Renderer<_Getter>(getter,args...), draw_list, cull_rect);
+    if (CanDeferRender(draw_list)) {
+        typedef RenderJob1<_Renderer,_Getter,Args...> Job;
+        DeferRender(IM_NEW(Job)(getter,args...), draw_list, cull_rect);
+    }
+    else
+        RenderPrimitivesEx(_Renderer<_Getter>(getter,args...), draw_list, cull_rect);
 }
 
 template <template <class,class> class _Renderer, class _Getter1, class _Getter2, typename ...Args>
 void RenderPrimitives2(const _Getter1& getter1, const _Getter2& getter2, Args... args) {
     ImDrawList& draw_list = *GetPlotDrawList();
     const ImRect& cull_rect = GetCurrentPlot()->PlotRect;
-    RenderPrimitivesEx(_Renderer<_Getter1,_Getter2>(getter1,getter2,args...), draw_list, cull_rect);
+    if (CanDeferRender(draw_list)) {
+        typedef RenderJob2<_Renderer,_Getter1,_Getter2,Args...> Job;
+        DeferRender(IM_NEW(Job)(getter1,getter2,args...), draw_list, cull_rect);
+    }
+    else
+        RenderPrimitivesEx(_Renderer<_Getter1,_Getter2>(getter1,getter2,args...), draw_list, cull_rect);
 }
 
 //-----------------------------------------------------------------------------
@@ -1419,6 +2140,7 @@ struct RendererMarkersFill : RendererBase {
     RendererMarkersFill(const _Getter& getter, const ImVec2* marker, int count, float size, ImU32 col) :
         RendererBase(getter.Count, (count-2)*3, count),
         Getter(getter),
+        Points(getter, this->Transformer),
         Marker(marker),
         Count(count),
         Size(size),
@@ -1428,7 +2150,7 @@ struct RendererMarkersFill : RendererBase {
         UV = draw_list._Data->TexUvWhitePixel;
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 p = this->Transformer(Getter(prim));
+        ImVec2 p = Points(prim);
         if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
             for (int i = 0; i < Count; i++) {
                 draw_list._VtxWritePtr[0].pos.x = p.x + Marker[i].x * Size;
@@ -1449,6 +2171,7 @@ struct RendererMarkersFill : RendererBase {
         return false;
     }
     const _Getter& Getter;
+    TransformerBatch<_Getter> Points;
     const ImVec2* Marker;
     const int Count;
     const float Size;
@@ -1462,6 +2185,7 @@ struct RendererMarkersLine : RendererBase {
     RendererMarkersLine(const _Getter& getter, const ImVec2* marker, int count, float size, float weight, ImU32 col) :
         RendererBase(getter.Count, count/2*6, count/2*4),
         Getter(getter),
+        Points(getter, this->Transformer),
         Marker(marker),
         Count(count),
         HalfWeight(ImMax(1.0f,weight)*0.5f),
@@ -1472,7 +2196,7 @@ struct RendererMarkersLine : RendererBase {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 p = this->Transformer(Getter(prim));
+        ImVec2 p = Points(prim);
         if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
             for (int i = 0; i < Count; i = i + 2) {
                 ImVec2 p1(p.x + Marker[i].x * Size, p.y + Marker[i].y * Size);
@@ -1484,6 +2208,7 @@ struct RendererMarkersLine : RendererBase {
         return false;
     }
     const _Getter& Getter;
+    TransformerBatch<_Getter> Points;
     const ImVec2* Marker;
     const int Count;
     mutable float HalfWeight;
@@ -1493,6 +2218,34 @@ struct RendererMarkersLine : RendererBase {
     mutable ImVec2 UV1;
 };
 
+template <class _Getter>
+struct RendererMarkersSprite : RendererBase {
+    RendererMarkersSprite(const _Getter& getter, const ImPlotMarkerSprite* sprite, float size, ImU32 col) :
+        RendererBase(getter.Count, 6, 4),
+        Getter(getter),
+        Points(getter, this->Transformer),
+        HalfSize(sprite->HalfSize * size / sprite->Radius),
+        UV0(sprite->UV0),
+        UV1(sprite->UV1),
+        Col(col)
+    { }
+    void Init(ImDrawList&) const { }
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+        ImVec2 p = Points(prim);
+        if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
+            PrimRectUV(draw_list, ImVec2(p.x - HalfSize, p.y - HalfSize), ImVec2(p.x + HalfSize, p.y + HalfSize), UV0, UV1, Col);
+            return true;
+        }
+        return false;
+    }
+    const _Getter& Getter;
+    TransformerBatch<_Getter> Points;
+    const float HalfSize;
+    const ImVec2 UV0;
+    const ImVec2 UV1;
+    const ImU32 Col;
+};
+
 static const ImVec2 MARKER_FILL_CIRCLE[10]  = {ImVec2(1.0f, 0.0f), ImVec2(0.809017f, 0.58778524f),ImVec2(0.30901697f, 0.95105654f),ImVec2(-0.30901703f, 0.9510565f),ImVec2(-0.80901706f, 0.5877852f),ImVec2(-1.0f, 0.0f),ImVec2(-0.80901694f, -0.58778536f),ImVec2(-0.3090171f, -0.9510565f),ImVec2(0.30901712f, -0.9510565f),ImVec2(0.80901694f, -0.5877853f)};
 static const ImVec2 MARKER_FILL_SQUARE[4]   = {ImVec2(SQRT_1_2,SQRT_1_2), ImVec2(SQRT_1_2,-SQRT_1_2), ImVec2(-SQRT_1_2,-SQRT_1_2), ImVec2(-SQRT_1_2,SQRT_1_2)};
 static const ImVec2 MARKER_FILL_DIAMOND[4]  = {ImVec2(1, 0), ImVec2(0, -1), ImVec2(-1, 0), ImVec2(0, 1)};
@@ -1533,10 +2286,167 @@ static const ImVec2 MARKER_LINE_ASTERISK[6] = {ImVec2(-SQRT_3_2, -0.5f), ImVec2(
 static const ImVec2 MARKER_LINE_PLUS[4]     = {ImVec2(-1, 0), ImVec2(1, 0), ImVec2(0, -1), ImVec2(0, 1)};
 static const ImVec2 MARKER_LINE_CROSS[4]    = {ImVec2(-SQRT_1_2,-SQRT_1_2),ImVec2(SQRT_1_2,SQRT_1_2),ImVec2(SQRT_1_2,-SQRT_1_2),ImVec2(-SQRT_1_2,SQRT_1_2)};
 
+// Number of sprites per marker shape and size: filled, outlined for each weight, filled and outlined for each weight
+static const int MARKER_SPRITE_KINDS = 1 + 2 * IMPLOT_MARKER_SPRITE_MAX_WEIGHT;
+
+// Distance from p to the segment [a,b]
+static inline float SegmentDistance(const ImVec2& a, const ImVec2& b, const ImVec2& p) {
+    return ImSqrt(ImLengthSqr(p - ImLineClosestPoint(a, b, p)));
+}
+
+// Signed distance in pixels from p to a marker centered on the origin, negative inside. With a weight, the distance is
+// to the outline of the marker, merged with the filled marker if fill is set.
+static float MarkerDistance(ImPlotMarker marker, float radius, float weight, bool fill, const ImVec2& p) {
+    const float half_weight = weight * 0.5f;
+    if (marker == ImPlotMarker_Circle) {
+        const float d = ImSqrt(ImLengthSqr(p)) - radius;
+        if (weight <= 0)
+            return d;
+        return fill ? d - half_weight : ImFabs(d) - half_weight;
+    }
+    const ImVec2* poly = nullptr;
+    const ImVec2* lines = nullptr;
+    int poly_count = 0, lines_count = 0;
+    switch (marker) {
+        case ImPlotMarker_Square   : poly = MARKER_FILL_SQUARE;  poly_count = 4; lines = MARKER_LINE_SQUARE;   lines_count = 8; break;
+        case ImPlotMarker_Diamond  : poly = MARKER_FILL_DIAMOND; poly_count = 4; lines = MARKER_LINE_DIAMOND;  lines_count = 8; break;
+        case ImPlotMarker_Up       : poly = MARKER_FILL_UP;      poly_count = 3; lines = MARKER_LINE_UP;       lines_count = 6; break;
+        case ImPlotMarker_Down     : poly = MARKER_FILL_DOWN;    poly_count = 3; lines = MARKER_LINE_DOWN;     lines_count = 6; break;
+        case ImPlotMarker_Left     : poly = MARKER_FILL_LEFT;    poly_count = 3; lines = MARKER_LINE_LEFT;     lines_count = 6; break;
+        case ImPlotMarker_Right    : poly = MARKER_FILL_RIGHT;   poly_count = 3; lines = MARKER_LINE_RIGHT;    lines_count = 6; break;
+        case ImPlotMarker_Asterisk :                                             lines = MARKER_LINE_ASTERISK; lines_count = 6; break;
+        case ImPlotMarker_Plus     :                                             lines = MARKER_LINE_PLUS;     lines_count = 4; break;
+        case ImPlotMarker_Cross    :                                             lines = MARKER_LINE_CROSS;    lines_count = 4; break;
+    }
+    float d_fill = FLT_MAX;
+    if (poly) {
+        // the filled markers are convex, p is inside if it is on the same side of every edge
+        float d_edges = FLT_MAX;
+        int sides = 0;
+        for (int i = 0; i < poly_count; ++i) {
+            const ImVec2 a = poly[i] * radius;
+            const ImVec2 b = poly[(i + 1) % poly_count] * radius;
+            d_edges = ImMin(d_edges, SegmentDistance(a, b, p));
+            sides += (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x) > 0 ? 1 : -1;
+        }
+        d_fill = (sides == poly_count || sides == -poly_count) ? -d_edges : d_edges;
+    }
+    if (weight <= 0)
+        return d_fill;
+    float d_line = FLT_MAX;
+    for (int i = 0; i < lines_count; i += 2)
+        d_line = ImMin(d_line, SegmentDistance(lines[i] * radius, lines[i+1] * radius, p));
+    d_line -= half_weight;
+    return fill ? ImMin(d_fill, d_line) : d_line;
+}
+
+void AddMarkerSprites(ImFontAtlas* atlas) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    AddMarkerSprites(atlas, GImPlot->MarkerSprites);
+}
+
+void AddMarkerSprites(ImFontAtlas* atlas, ImPlotMarkerSprites& sprites) {
+    sprites.Atlas = atlas;
+    sprites.Ready = false;
+    for (int m = 0; m < ImPlotMarker_COUNT; ++m) {
+        for (int k = 0; k < MARKER_SPRITE_KINDS; ++k) {
+            const bool fill   = k == 0 || k > IMPLOT_MARKER_SPRITE_MAX_WEIGHT;
+            const int  weight = k == 0 ? 0 : (k - 1) % IMPLOT_MARKER_SPRITE_MAX_WEIGHT + 1;
+            for (int r = 1; r <= IMPLOT_MARKER_SPRITE_MAX_SIZE; ++r) {
+                ImPlotMarkerSprite& sprite = sprites.Sprites[m][k][r-1];
+                sprite.Radius = (float)r;
+                // cross, plus and asterisk are not fillable, GetMarkerSprite falls back to their outlined sprites
+                if (fill && m >= ImPlotMarker_Cross) {
+                    sprite.RectId = -1;
+                    continue;
+                }
+                // a pixel around the outline for anti-aliasing, and an even size to center the marker on a texel corner
+                const int size = 2 * (int)ImCeil(r + weight * 0.5f + 1);
+                sprite.RectId   = atlas->AddCustomRectRegular(size, size);
+                sprite.HalfSize = size * 0.5f;
+            }
+        }
+    }
+}
+
+void BuildMarkerSprites(ImFontAtlas* atlas) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    BuildMarkerSprites(atlas, GImPlot->MarkerSprites);
+}
+
+void BuildMarkerSprites(ImFontAtlas* atlas, ImPlotMarkerSprites& sprites) {
+    sprites.Ready = false;
+    if (sprites.Atlas != atlas || !atlas->IsBuilt())
+        return;
+    for (int m = 0; m < ImPlotMarker_COUNT; ++m) {
+        for (int k = 0; k < MARKER_SPRITE_KINDS; ++k) {
+            const bool fill   = k == 0 || k > IMPLOT_MARKER_SPRITE_MAX_WEIGHT;
+            const int  weight = k == 0 ? 0 : (k - 1) % IMPLOT_MARKER_SPRITE_MAX_WEIGHT + 1;
+            for (int r = 1; r <= IMPLOT_MARKER_SPRITE_MAX_SIZE; ++r) {
+                ImPlotMarkerSprite& sprite = sprites.Sprites[m][k][r-1];
+                if (sprite.RectId < 0)
+                    continue;
+                // the rects are gone if the atlas was cleared since AddMarkerSprites
+                if (sprite.RectId >= atlas->CustomRects.Size)
+                    return;
+                const ImFontAtlasCustomRect* rect = atlas->GetCustomRectByIndex(sprite.RectId);
+                if (!rect->IsPacked() || rect->Width != (int)(sprite.HalfSize * 2))
+                    return;
+                atlas->CalcCustomRectUV(rect, &sprite.UV0, &sprite.UV1);
+                for (int y = 0; y < rect->Height; ++y) {
+                    for (int x = 0; x < rect->Width; ++x) {
+                        const ImVec2 p(x + 0.5f - sprite.HalfSize, y + 0.5f - sprite.HalfSize);
+                        const float coverage = ImClamp(0.5f - MarkerDistance(m, (float)r, (float)weight, fill, p), 0.0f, 1.0f);
+                        const unsigned char alpha = (unsigned char)(coverage * 255 + 0.5f);
+                        const int offset = (rect->Y + y) * atlas->TexWidth + rect->X + x;
+                        if (atlas->TexPixelsAlpha8)
+                            atlas->TexPixelsAlpha8[offset] = alpha;
+                        if (atlas->TexPixelsRGBA32)
+                            atlas->TexPixelsRGBA32[offset] = IM_COL32(255, 255, 255, alpha);
+                    }
+                }
+            }
+        }
+    }
+    sprites.Ready = true;
+}
+
+// Returns the sprite of a marker if it was rasterized into the texture the draw list is using, nullptr otherwise. A
+// weight of 0 is for the filled marker, otherwise for its outline, merged with the filled marker if fill is set.
+static const ImPlotMarkerSprite* GetMarkerSprite(const ImDrawList& draw_list, ImPlotMarker marker, float size, float weight, bool fill) {
+    const ImPlotMarkerSprites& sprites = GImPlot->MarkerSprites;
+    if (!sprites.Ready || marker < 0 || marker >= ImPlotMarker_COUNT || draw_list._CmdHeader.TextureId != sprites.Atlas->TexID)
+        return nullptr;
+    // sizes between the rasterized ones stretch the nearest sprite
+    const int r = (int)(size + 0.5f);
+    if (r < 1 || r > IMPLOT_MARKER_SPRITE_MAX_SIZE)
+        return nullptr;
+    int k = 0;
+    if (weight > 0) {
+        const int w = (int)(weight + 0.5f);
+        if (w > IMPLOT_MARKER_SPRITE_MAX_WEIGHT || ImFabs(weight - w) > 0.01f)
+            return nullptr;
+        k = fill && marker < ImPlotMarker_Cross ? IMPLOT_MARKER_SPRITE_MAX_WEIGHT + w : w;
+    }
+    const ImPlotMarkerSprite* sprite = &sprites.Sprites[marker][k][r-1];
+    return sprite->RectId >= 0 ? sprite : nullptr;
+}
+
 template <typename _Getter>
 void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool rend_fill, ImU32 col_fill, bool rend_line, ImU32 col_line, float weight) {
+    // outlines are at least 1 pixel wide, see RendererMarkersLine
+    const float line_weight = ImMax(1.0f, weight);
+    const ImDrawList& draw_list = *GetPlotDrawList();
+    if (rend_fill && rend_line && col_fill == col_line) {
+        if (const ImPlotMarkerSprite* sprite = GetMarkerSprite(draw_list, marker, size, line_weight, true)) {
+            RenderPrimitives1<RendererMarkersSprite>(getter, sprite, size, col_fill);
+            return;
+        }
+    }
     if (rend_fill) {
-        switch (marker) {
+        if (const ImPlotMarkerSprite* sprite = GetMarkerSprite(draw_list, marker, size, 0, true))
+            RenderPrimitives1<RendererMarkersSprite>(getter, sprite, size, col_fill);
+        else switch (marker) {
             case ImPlotMarker_Circle  : RenderPrimitives1<RendererMarkersFill>(getter,MARKER_FILL_CIRCLE,10,size,col_fill); break;
             case ImPlotMarker_Square  : RenderPrimitives1<RendererMarkersFill>(getter,MARKER_FILL_SQUARE, 4,size,col_fill); break;
             case ImPlotMarker_Diamond : RenderPrimitives1<RendererMarkersFill>(getter,MARKER_FILL_DIAMOND,4,size,col_fill); break;
@@ -1547,7 +2457,9 @@ void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool
         }
     }
     if (rend_line) {
-        switch (marker) {
+        if (const ImPlotMarkerSprite* sprite = GetMarkerSprite(draw_list, marker, size, line_weight, false))
+            RenderPrimitives1<RendererMarkersSprite>(getter, sprite, size, col_line);
+        else switch (marker) {
             case ImPlotMarker_Circle    : RenderPrimitives1<RendererMarkersLine>(getter,MARKER_LINE_CIRCLE, 20,size,weight,col_line); break;
             case ImPlotMarker_Square    : RenderPrimitives1<RendererMarkersLine>(getter,MARKER_LINE_SQUARE,  8,size,weight,col_line); break;
             case ImPlotMarker_Diamond   : RenderPrimitives1<RendererMarkersLine>(getter,MARKER_LINE_DIAMOND, 8,size,weight,col_line); break;
@@ -1567,37 +2479,47 @@ void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool
 //-----------------------------------------------------------------------------
 
 template <typename _Getter>
-void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags flags) {
-    if (BeginItemEx(label_id, Fitter1<_Getter>(getter), flags, ImPlotCol_Line)) {
+void RenderLineEx(const _Getter& getter, ImPlotLineFlags flags, const ImPlotNextItemData& s) {
+    if (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
+        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+        GetterOverrideY<_Getter> getter2(getter, 0);
+        RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
+    }
+    if (s.RenderLine) {
+        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
+        if (ImHasFlag(flags,ImPlotLineFlags_Segments)) {
+            RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.LineWeight);
+        }
+        else if (ImHasFlag(flags, ImPlotLineFlags_Loop)) {
+            if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
+                RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+            else
+                RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+        }
+        else {
+            if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
+                RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.LineWeight);
+            else
+                RenderPrimitives1<RendererLineStrip>(getter,col_line,s.LineWeight);
+        }
+    }
+}
+
+template <typename _Getter, typename _Fitter>
+void PlotLineEx(const char* label_id, const _Getter& getter, const _Fitter& fitter, ImPlotLineFlags flags) {
+    if (BeginItemEx(label_id, fitter, flags, ImPlotCol_Line)) {
         if (getter.Count <= 0) {
             EndItem();
             return;
         }
         const ImPlotNextItemData& s = GetItemData();
         if (getter.Count > 1) {
-            if (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
-                const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-                GetterOverrideY<_Getter> getter2(getter, 0);
-                RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
-            }
-            if (s.RenderLine) {
-                const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
-                if (ImHasFlag(flags,ImPlotLineFlags_Segments)) {
-                    RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.LineWeight);
-                }
-                else if (ImHasFlag(flags, ImPlotLineFlags_Loop)) {
-                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
-                }
-                else {
-                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(getter,col_line,s.LineWeight);
-                }
-            }
+            ImVector<ImPlotPoint>& points = GetItemPoints();
+            const bool can_downsample = !(flags & (ImPlotLineFlags_Segments | ImPlotLineFlags_Loop | ImPlotLineFlags_NoDownsample));
+            if (can_downsample && Downsample(getter, ImHasFlag(flags, ImPlotLineFlags_DownsampleLTTB), ImHasFlag(flags, ImPlotLineFlags_SkipNaN), points))
+                RenderLineEx(GetterPoints(points.Data, points.Size), flags, s);
+            else
+                RenderLineEx(getter, flags, s);
         }
         // render markers
         if (s.Marker != ImPlotMarker_None) {
@@ -1613,6 +2535,11 @@ void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags fla
     }
 }
 
+template <typename _Getter>
+void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags flags) {
+    PlotLineEx(label_id, getter, Fitter1<_Getter>(getter), flags);
+}
+
 template <typename T>
 void PlotLine(const char* label_id, const T* values, int count, double xscale, double x0, ImPlotLineFlags flags, int offset, int stride) {
     GetterXY<IndexerLin,IndexerIdx<T>> getter(IndexerLin(xscale,x0),IndexerIdx<T>(values,count,offset,stride),count);
@@ -1637,13 +2564,59 @@ void PlotLineG(const char* label_id, ImPlotGetter getter_func, void* data, int c
     PlotLineEx(label_id, getter, flags);
 }
 
+// cached series
+template <typename _Getter>
+void RenderLineSeriesEx(const _Getter& getter, ImPlotLineFlags flags, const ImPlotNextItemData& s) {
+    if (getter.Count > 1)
+        RenderLineEx(getter, flags, s);
+    if (s.Marker != ImPlotMarker_None) {
+        if (ImHasFlag(flags, ImPlotLineFlags_NoClip)) {
+            PopPlotClipRect();
+            PushPlotClipRect(s.MarkerSize);
+        }
+        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
+        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
+        RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+    }
+}
+
+void PlotLine(const char* label_id, const ImPlotSeries& series, ImPlotLineFlags flags) {
+    GetterSeries getter(series);
+    if (ImHasFlag(flags, ImPlotLineFlags_Segments) || ImHasFlag(flags, ImPlotLineFlags_Loop)) {
+        PlotLineEx(label_id, getter, flags);
+        return;
+    }
+    if (BeginItemEx(label_id, FitterSeries(series), flags, ImPlotCol_Line)) {
+        if (getter.Count <= 0) {
+            EndItem();
+            return;
+        }
+        ImVector<ImPlotPoint>& points = GetItemPoints();
+        const bool reduce = !ImHasFlag(flags, ImPlotLineFlags_NoDownsample);
+        if (GetSeriesPoints(series, reduce, points) || (reduce && Downsample(getter, ImHasFlag(flags, ImPlotLineFlags_DownsampleLTTB), ImHasFlag(flags, ImPlotLineFlags_SkipNaN), points)))
+            RenderLineSeriesEx(GetterPoints(points.Data, points.Size), flags, GetItemData());
+        else
+            RenderLineSeriesEx(getter, flags, GetItemData());
+        EndItem();
+    }
+}
+
+// stream
+void PlotLine(const char* label_id, const ImPlotStreamSeries& stream, ImPlotLineFlags flags) {
+    ImPlotRect bounds;
+    int first;
+    const int count = stream._Snapshot(&first, &bounds);
+    GetterStream getter(stream._Slots, stream._SlotCount, first, count);
+    PlotLineEx(label_id, getter, FitterStream(getter, bounds), flags);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotScatter
 //-----------------------------------------------------------------------------
 
-template <typename Getter>
-void PlotScatterEx(const char* label_id, const Getter& getter, ImPlotScatterFlags flags) {
-    if (BeginItemEx(label_id, Fitter1<Getter>(getter), flags, ImPlotCol_MarkerOutline)) {
+template <typename Getter, typename Fitter>
+void PlotScatterEx(const char* label_id, const Getter& getter, const Fitter& fitter, ImPlotScatterFlags flags) {
+    if (BeginItemEx(label_id, fitter, flags, ImPlotCol_MarkerOutline)) {
         if (getter.Count <= 0) {
             EndItem();
             return;
@@ -1663,6 +2636,11 @@ void PlotScatterEx(const char* label_id, const Getter& getter, ImPlotScatterFlag
     }
 }
 
+template <typename Getter>
+void PlotScatterEx(const char* label_id, const Getter& getter, ImPlotScatterFlags flags) {
+    PlotScatterEx(label_id, getter, Fitter1<Getter>(getter), flags);
+}
+
 template <typename T>
 void PlotScatter(const char* label_id, const T* values, int count, double xscale, double x0, ImPlotScatterFlags flags, int offset, int stride) {
     GetterXY<IndexerLin,IndexerIdx<T>> getter(IndexerLin(xscale,x0),IndexerIdx<T>(values,count,offset,stride),count);
@@ -1687,10 +2665,37 @@ void PlotScatterG(const char* label_id, ImPlotGetter getter_func, void* data, in
     return PlotScatterEx(label_id, getter, flags);
 }
 
+// stream
+void PlotScatter(const char* label_id, const ImPlotStreamSeries& stream, ImPlotScatterFlags flags) {
+    ImPlotRect bounds;
+    int first;
+    const int count = stream._Snapshot(&first, &bounds);
+    GetterStream getter(stream._Slots, stream._SlotCount, first, count);
+    PlotScatterEx(label_id, getter, FitterStream(getter, bounds), flags);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotStairs
 //-----------------------------------------------------------------------------
 
+template <typename Getter>
+void RenderStairsEx(const Getter& getter, ImPlotStairsFlags flags, const ImPlotNextItemData& s) {
+    if (s.RenderFill && ImHasFlag(flags,ImPlotStairsFlags_Shaded)) {
+        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+        if (ImHasFlag(flags, ImPlotStairsFlags_PreStep))
+            RenderPrimitives1<RendererStairsPreShaded>(getter,col_fill);
+        else
+            RenderPrimitives1<RendererStairsPostShaded>(getter,col_fill);
+    }
+    if (s.RenderLine) {
+        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
+        if (ImHasFlag(flags, ImPlotStairsFlags_PreStep))
+            RenderPrimitives1<RendererStairsPre>(getter,col_line,s.LineWeight);
+        else
+            RenderPrimitives1<RendererStairsPost>(getter,col_line,s.LineWeight);
+    }
+}
+
 template <typename Getter>
 void PlotStairsEx(const char* label_id, const Getter& getter, ImPlotStairsFlags flags) {
     if (BeginItemEx(label_id, Fitter1<Getter>(getter), flags, ImPlotCol_Line)) {
@@ -1700,20 +2705,11 @@ void PlotStairsEx(const char* label_id, const Getter& getter, ImPlotStairsFlags
         }
         const ImPlotNextItemData& s = GetItemData();
         if (getter.Count > 1) {
-            if (s.RenderFill && ImHasFlag(flags,ImPlotStairsFlags_Shaded)) {
-                const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-                if (ImHasFlag(flags, ImPlotStairsFlags_PreStep))
-                    RenderPrimitives1<RendererStairsPreShaded>(getter,col_fill);
-                else
-                    RenderPrimitives1<RendererStairsPostShaded>(getter,col_fill);
-            }
-            if (s.RenderLine) {
-                const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
-                if (ImHasFlag(flags, ImPlotStairsFlags_PreStep))
-                    RenderPrimitives1<RendererStairsPre>(getter,col_line,s.LineWeight);
-                else
-                    RenderPrimitives1<RendererStairsPost>(getter,col_line,s.LineWeight);
-            }
+            ImVector<ImPlotPoint>& points = GetItemPoints();
+            if (!ImHasFlag(flags, ImPlotStairsFlags_NoDownsample) && Downsample(getter, ImHasFlag(flags, ImPlotStairsFlags_DownsampleLTTB), false, points))
+                RenderStairsEx(GetterPoints(points.Data, points.Size), flags, s);
+            else
+                RenderStairsEx(getter, flags, s);
         }
         // render markers
         if (s.Marker != ImPlotMarker_None) {
@@ -1751,6 +2747,37 @@ void PlotStairsG(const char* label_id, ImPlotGetter getter_func, void* data, int
     return PlotStairsEx(label_id, getter, flags);
 }
 
+// cached series
+template <typename Getter>
+void RenderStairsSeriesEx(const Getter& getter, ImPlotStairsFlags flags, const ImPlotNextItemData& s) {
+    if (getter.Count > 1)
+        RenderStairsEx(getter, flags, s);
+    if (s.Marker != ImPlotMarker_None) {
+        PopPlotClipRect();
+        PushPlotClipRect(s.MarkerSize);
+        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
+        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
+        RenderMarkers<Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+    }
+}
+
+void PlotStairs(const char* label_id, const ImPlotSeries& series, ImPlotStairsFlags flags) {
+    GetterSeries getter(series);
+    if (BeginItemEx(label_id, FitterSeries(series), flags, ImPlotCol_Line)) {
+        if (getter.Count <= 0) {
+            EndItem();
+            return;
+        }
+        ImVector<ImPlotPoint>& points = GetItemPoints();
+        const bool reduce = !ImHasFlag(flags, ImPlotStairsFlags_NoDownsample);
+        if (GetSeriesPoints(series, reduce, points) || (reduce && Downsample(getter, ImHasFlag(flags, ImPlotStairsFlags_DownsampleLTTB), false, points)))
+            RenderStairsSeriesEx(GetterPoints(points.Data, points.Size), flags, GetItemData());
+        else
+            RenderStairsSeriesEx(getter, flags, GetItemData());
+        EndItem();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotShaded
 //-----------------------------------------------------------------------------
@@ -1925,6 +2952,8 @@ void PlotBarGroups(const char* const label_ids[], const T* values, int item_coun
     if (stack) {
         SetupLock();
         ImPlotContext& gp = *GImPlot;
+        // the bars of each item are computed in a temp buffer, they can't be deferred
+        gp.ParallelRenderLock++;
         gp.TempDouble1.resize(4*group_count);
         double* temp = gp.TempDouble1.Data;
         double* neg =      &temp[0];
@@ -1977,6 +3006,7 @@ void PlotBarGroups(const char* const label_ids[], const T* values, int item_coun
                 PlotBarsVEx(label_ids[i],getter1,getter2,group_size,0);
             }
         }
+        gp.ParallelRenderLock--;
     }
     else {
         const double subsize = group_size / item_count;
@@ -2352,7 +3382,9 @@ struct GetterHeatmapRowMaj {
         XRef(xref),
         YRef(yref),
         YDir(ydir),
-        HalfSize(Width*0.5, Height*0.5)
+        HalfSize(Width*0.5, Height*0.5),
+        Colormap(GImPlot->Style.Colormap),
+        ColormapData(&GImPlot->ColormapData)
     { }
     template <typename I> IMPLOT_INLINE RectC operator()(I idx) const {
         double val = (double)Values[idx];
@@ -2363,14 +3395,15 @@ struct GetterHeatmapRowMaj {
         rect.Pos = p;
         rect.HalfSize = HalfSize;
         const float t = ImClamp((float)ImRemap01(val, ScaleMin, ScaleMax),0.0f,1.0f);
-        ImPlotContext& gp = *GImPlot;
-        rect.Color = gp.ColormapData.LerpTable(gp.Style.Colormap, t);
+        rect.Color = ColormapData->LerpTable(Colormap, t);
         return rect;
     }
     const T* const Values;
     const int Count, Rows, Cols;
     const double ScaleMin, ScaleMax, Width, Height, XRef, YRef, YDir;
     const ImPlotPoint HalfSize;
+    const ImPlotColormap Colormap;
+    const ImPlotColormapData* const ColormapData; // captured on submission, getters of deferred items run on worker threads
 };
 
 template <typename T>
@@ -2387,7 +3420,9 @@ struct GetterHeatmapColMaj {
         XRef(xref),
         YRef(yref),
         YDir(ydir),
-        HalfSize(Width*0.5, Height*0.5)
+        HalfSize(Width*0.5, Height*0.5),
+        Colormap(GImPlot->Style.Colormap),
+        ColormapData(&GImPlot->ColormapData)
     { }
     template <typename I> IMPLOT_INLINE RectC operator()(I idx) const {
         double val = (double)Values[idx];
@@ -2398,14 +3433,15 @@ struct GetterHeatmapColMaj {
         rect.Pos = p;
         rect.HalfSize = HalfSize;
         const float t = ImClamp((float)ImRemap01(val, ScaleMin, ScaleMax),0.0f,1.0f);
-        ImPlotContext& gp = *GImPlot;
-        rect.Color = gp.ColormapData.LerpTable(gp.Style.Colormap, t);
+        rect.Color = ColormapData->LerpTable(Colormap, t);
         return rect;
     }
     const T* const Values;
     const int Count, Rows, Cols;
     const double ScaleMin, ScaleMax, Width, Height, XRef, YRef, YDir;
     const ImPlotPoint HalfSize;
+    const ImPlotColormap Colormap;
+    const ImPlotColormapData* const ColormapData; // captured on submission, getters of deferred items run on worker threads
 };
 
 template <typename T>
@@ -2435,51 +3471,52 @@ void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, d
         GetterHeatmapRowMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
         RenderPrimitives1<RendererRectC>(getter);
     }
-    // labels
-    if (fmt != nullptr) {
-        const double w = (bounds_max.x - bounds_min.x) / cols;
-        const double h = (bounds_max.y - bounds_min.y) / rows;
-        const ImPlotPoint half_size(w*0.5,h*0.5);
-        int i = 0;
-        if (col_maj) {
-            for (int c = 0; c < cols; ++c) {
-                for (int r = 0; r < rows; ++r) {
-                    ImPlotPoint p;
-                    p.x = bounds_min.x + 0.5*w + c*w;
-                    p.y = yref + ydir * (0.5*h + r*h);
-                    ImVec2 px = transformer(p);
-                    char buff[32];
-                    ImFormatString(buff, 32, fmt, values[i]);
-                    ImVec2 size = ImGui::CalcTextSize(buff);
-                    double t = ImClamp(ImRemap01((double)values[i], scale_min, scale_max),0.0,1.0);
-                    ImVec4 color = SampleColormap((float)t);
-                    ImU32 col = CalcTextColor(color);
-                    draw_list.AddText(px - size * 0.5f, col, buff);
-                    i++;
-                }
-            }
-        }
-        else {
-            for (int r = 0; r < rows; ++r) {
-                for (int c = 0; c < cols; ++c) {
-                    ImPlotPoint p;
-                    p.x = bounds_min.x + 0.5*w + c*w;
-                    p.y = yref + ydir * (0.5*h + r*h);
-                    ImVec2 px = transformer(p);
-                    char buff[32];
-                    ImFormatString(buff, 32, fmt, values[i]);
-                    ImVec2 size = ImGui::CalcTextSize(buff);
-                    double t = ImClamp(ImRemap01((double)values[i], scale_min, scale_max),0.0,1.0);
-                    ImVec4 color = SampleColormap((float)t);
-                    ImU32 col = CalcTextColor(color);
-                    draw_list.AddText(px - size * 0.5f, col, buff);
-                    i++;
-                }
-            }
-        }
-    }
+    if (fmt != nullptr)
+        RenderHeatmapLabels(draw_list, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max, reverse_y, col_maj);
 }
 
+template <typename T>
+void RenderHeatmapLabels(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj) {
+    const ImPlotPlot& plot = *GImPlot->CurrentPlot;
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+    Transformer2 transformer(x_axis, y_axis);
+    const double w = (bounds_max.x - bounds_min.x) / cols;
+    const double h = (bounds_max.y - bounds_min.y) / rows;
+    const double yref = reverse_y ? bounds_max.y : bounds_min.y;
+    const double ydir = reverse_y ? -1 : 1;
+    // visible cells, labels are skipped altogether when there are more than fit in the plot
+    const double c0 = (x_axis.Range.Min - bounds_min.x) / w, c1 = (x_axis.Range.Max - bounds_min.x) / w;
+    const double r0 = (y_axis.Range.Min - yref) / (ydir * h), r1 = (y_axis.Range.Max - yref) / (ydir * h);
+    const int c_min = (int)ImClamp(floor(ImMin(c0, c1)), 0.0, (double)cols), c_max = (int)ImClamp(ceil(ImMax(c0, c1)), 0.0, (double)cols);
+    const int r_min = (int)ImClamp(floor(ImMin(r0, r1)), 0.0, (double)rows), r_max = (int)ImClamp(ceil(ImMax(r0, r1)), 0.0, (double)rows);
+    const float font_size = ImGui::GetFontSize();
+    if ((c_max - c_min) * font_size > plot.PlotRect.GetWidth() || (r_max - r_min) * font_size > plot.PlotRect.GetHeight())
+        return;
+    for (int r = r_min; r < r_max; ++r) {
+        for (int c = c_min; c < c_max; ++c) {
+            const ImVec2 a = transformer(bounds_min.x + c*w, yref + ydir * r*h);
+            const ImVec2 b = transformer(bounds_min.x + (c+1)*w, yref + ydir * (r+1)*h);
+            const ImVec2 cell_size(ImAbs(b.x - a.x), ImAbs(b.y - a.y));
+            if (cell_size.y < font_size)
+                continue;
+            const T value = values[col_maj ? c * rows + r : r * cols + c];
+            char buff[32];
+            ImFormatString(buff, 32, fmt, value);
+            const ImVec2 size = ImGui::CalcTextSize(buff);
+            if (size.x > cell_size.x)
+                continue;
+            double t = ImClamp(ImRemap01((double)value, scale_min, scale_max),0.0,1.0);
+            ImVec4 color = SampleColormap((float)t);
+            ImU32 col = CalcTextColor(color);
+            draw_list.AddText((a + b) * 0.5f - size * 0.5f, col, buff);
+        }
+    }
+}
+#define INSTANTIATE_MACRO(T) template IMPLOT_API void RenderHeatmapLabels<T>(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
 template <typename T>
 void PlotHeatmap(const char* label_id, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, ImPlotHeatmapFlags flags) {
     if (BeginItemEx(label_id, FitterRect(bounds_min, bounds_max))) {
@@ -2501,6 +3538,156 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotHistogram
 //-----------------------------------------------------------------------------
 
+// Samples are binned in blocks: bin indices are computed branch-free so the first loop vectorizes, then counted.
+static const int HistogramBlockSize = 256;
+
+// Returns the bin of a value, bins for values below the range and bins+1 for values above the range or NaN.
+static inline int HistogramBin(double val, const ImPlotRange& range, double width, int bins) {
+    // clamp before converting so that every branch can become a select
+    double t = (val - range.Min) / width;
+    t = t > 0 ? t : 0;
+    t = t < bins - 1 ? t : bins - 1;
+    const int outside = val < range.Min ? bins : bins + 1;
+    return ((val >= range.Min) & (val <= range.Max)) ? (int)t : outside;
+}
+
+// Number of tasks a histogram of count samples into size bins is split into.
+static inline int HistogramChunks(int count, int size) {
+    if (GImPlot->ParallelFor == nullptr)
+        return 1;
+    // fewer tasks for many bins, as every task zeroes and merges its own partial counts
+    return ImClamp(count / ImMax(IMPLOT_HISTOGRAM_CHUNK_SIZE, 4 * size), 1, IMPLOT_HISTOGRAM_MAX_CHUNKS);
+}
+
+// Runs func for every chunk, through the ParallelFor callback if there is more than one.
+static inline void HistogramParallelFor(int chunks, void (*func)(int, void*), void* data) {
+    if (chunks > 1)
+        GImPlot->ParallelFor(chunks, func, data);
+    else
+        func(0, data);
+}
+
+template <typename T>
+struct HistogramMinMaxJob {
+    const T* Values;
+    int      Count;
+    int      Chunks;
+    T        Mins[IMPLOT_HISTOGRAM_MAX_CHUNKS];
+    T        Maxs[IMPLOT_HISTOGRAM_MAX_CHUNKS];
+    static void Run(int chunk, void* data) {
+        HistogramMinMaxJob& job = *(HistogramMinMaxJob*)data;
+        const int first = (int)((ImS64)job.Count * chunk / job.Chunks);
+        const int last  = (int)((ImS64)job.Count * (chunk + 1) / job.Chunks);
+        ImMinMaxArray(job.Values + first, last - first, &job.Mins[chunk], &job.Maxs[chunk]);
+    }
+};
+
+// Same as ImMinMaxArray, split across tasks for large arrays.
+template <typename T>
+static void HistogramMinMax(const T* values, int count, T* min_out, T* max_out) {
+    HistogramMinMaxJob<T> job;
+    job.Values = values;
+    job.Count  = count;
+    job.Chunks = HistogramChunks(count, 0);
+    HistogramParallelFor(job.Chunks, HistogramMinMaxJob<T>::Run, &job);
+    *min_out = job.Mins[0];
+    *max_out = job.Maxs[0];
+    for (int c = 1; c < job.Chunks; ++c) {
+        if (job.Mins[c] < *min_out) *min_out = job.Mins[c];
+        if (job.Maxs[c] > *max_out) *max_out = job.Maxs[c];
+    }
+}
+
+template <typename T>
+struct HistogramJob {
+    const T*   Xs;
+    const T*   Ys; // nullptr for 1D histograms
+    int        Count;
+    int        Chunks;
+    ImPlotRect Range;
+    double     Width, Height;
+    int        XBins, YBins;
+    int        Size;
+    int*       Partials;
+    static void Run(int chunk, void* data) {
+        HistogramJob& job = *(HistogramJob*)data;
+        int* counts = job.Partials + chunk * job.Size;
+        memset(counts, 0, job.Size * sizeof(int));
+        const int first = (int)((ImS64)job.Count * chunk / job.Chunks);
+        const int last  = (int)((ImS64)job.Count * (chunk + 1) / job.Chunks);
+        const int outside = job.XBins * job.YBins;
+        int bins[HistogramBlockSize];
+        for (int i = first; i < last; i += HistogramBlockSize) {
+            const int n = ImMin(HistogramBlockSize, last - i);
+            if (job.Ys == nullptr) {
+                const T* xs = job.Xs + i;
+                for (int k = 0; k < n; ++k)
+                    bins[k] = HistogramBin((double)xs[k], job.Range.X, job.Width, job.XBins);
+            }
+            else {
+                const T* xs = job.Xs + i;
+                const T* ys = job.Ys + i;
+                for (int k = 0; k < n; ++k) {
+                    const int xb = HistogramBin((double)xs[k], job.Range.X, job.Width, job.XBins);
+                    const int yb = HistogramBin((double)ys[k], job.Range.Y, job.Height, job.YBins);
+                    bins[k] = (xb < job.XBins && yb < job.YBins) ? yb * job.XBins + xb : outside;
+                }
+            }
+            for (int k = 0; k < n; ++k)
+                counts[bins[k]]++;
+        }
+    }
+};
+
+// Bins count samples into counts_out, split across tasks with partial counts for large arrays. 1D histograms (ys is
+// nullptr) have x_bins+2 counts, the last two being the samples below and above the range. 2D histograms have
+// x_bins*y_bins+1 counts, the last one being the samples outside the range.
+template <typename T>
+static void BinHistogram(const T* xs, const T* ys, int count, const ImPlotRect& range, double width, double height, int x_bins, int y_bins, ImVector<int>& counts_out) {
+    HistogramJob<T> job;
+    job.Xs     = xs;
+    job.Ys     = ys;
+    job.Count  = count;
+    job.Range  = range;
+    job.Width  = width;
+    job.Height = height;
+    job.XBins  = x_bins;
+    job.YBins  = y_bins;
+    job.Size   = ys == nullptr ? x_bins + 2 : x_bins * y_bins + 1;
+    job.Chunks = HistogramChunks(count, job.Size);
+    counts_out.resize(job.Size * job.Chunks);
+    job.Partials = counts_out.Data;
+    HistogramParallelFor(job.Chunks, HistogramJob<T>::Run, &job);
+    for (int c = 1; c < job.Chunks; ++c) {
+        const int* partial = job.Partials + c * job.Size;
+        for (int b = 0; b < job.Size; ++b)
+            counts_out[b] += partial[b];
+    }
+    counts_out.shrink(job.Size);
+}
+
+// Returns the cached bins of a histogram, or nullptr and the entry to fill in new_out. Entries that were not used
+// during the previous frame are released.
+static ImPlotHistogramCache* GetHistogramCache(const ImPlotHistogramKey& key, ImPlotHistogramCache** new_out) {
+    ImPlotContext& gp = *GImPlot;
+    const int frame = ImGui::GetFrameCount();
+    if (gp.HistogramCacheFrame != frame) {
+        for (int i = 0; i < gp.HistogramCache.GetMapSize(); ++i) {
+            ImPlotHistogramCache* cache = gp.HistogramCache.TryGetMapData(i);
+            if (cache != nullptr && cache->LastFrame < frame - 1)
+                gp.HistogramCache.Remove(gp.HistogramCache.Map.Data[i].key, cache);
+        }
+        gp.HistogramCacheFrame = frame;
+    }
+    const ImGuiID id = ImHashData(&key, sizeof(key));
+    ImPlotHistogramCache* cache = gp.HistogramCache.GetOrAddByKey(id);
+    const bool hit = cache->LastFrame >= 0 && memcmp(&cache->Key, &key, sizeof(key)) == 0;
+    cache->Key = key;
+    cache->LastFrame = frame;
+    *new_out = hit ? nullptr : cache;
+    return hit ? cache : nullptr;
+}
+
 template <typename T>
 double PlotHistogram(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags) {
 
@@ -2511,72 +3698,102 @@ double PlotHistogram(const char* label_id, const T* values, int count, int bins,
     if (count <= 0 || bins == 0)
         return 0;
 
-    if (range.Min == 0 && range.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(values, count, &Min, &Max);
-        range.Min = (double)Min;
-        range.Max = (double)Max;
-    }
-
-    double width;
-    if (bins < 0)
-        CalculateBins(values, count, bins, range, bins, width);
-    else
-        width = range.Size() / bins;
-
     ImPlotContext& gp = *GImPlot;
     ImVector<double>& bin_centers = gp.TempDouble1;
     ImVector<double>& bin_counts  = gp.TempDouble2;
-    bin_centers.resize(bins);
-    bin_counts.resize(bins);
-    int below = 0;
-
-    for (int b = 0; b < bins; ++b) {
-        bin_centers[b] = range.Min + b * width + width * 0.5;
-        bin_counts[b] = 0;
+    double width, max_count;
+
+    ImPlotHistogramCache* cached = nullptr;
+    ImPlotHistogramCache* uncached = nullptr;
+    if (ImHasFlag(flags, ImPlotHistogramFlags_Cache)) {
+        ImPlotHistogramKey key;
+        key.Xs       = values;
+        key.Count    = count;
+        key.XBins    = bins;
+        key.Flags    = flags;
+        key.TypeSize = sizeof(T);
+        key.Range.X  = range;
+        cached = GetHistogramCache(key, &uncached);
+    }
+
+    if (cached) {
+        range      = cached->Range.X;
+        bins       = cached->XBins;
+        width      = cached->Width;
+        max_count  = cached->MaxCount;
+        bin_counts = cached->Counts;
     }
-    int counted = 0;
-    double max_count = 0;
-    for (int i = 0; i < count; ++i) {
-        double val = (double)values[i];
-        if (range.Contains(val)) {
-            const int b = ImClamp((int)((val - range.Min) / width), 0, bins - 1);
-            bin_counts[b] += 1.0;
+    else {
+        if (range.Min == 0 && range.Max == 0) {
+            T Min, Max;
+            HistogramMinMax(values, count, &Min, &Max);
+            range.Min = (double)Min;
+            range.Max = (double)Max;
+        }
+
+        if (bins < 0)
+            CalculateBins(values, count, bins, range, bins, width);
+        else
+            width = range.Size() / bins;
+
+        ImVector<int>& counts = gp.TempInt1;
+        BinHistogram(values, (const T*)nullptr, count, ImPlotRect(range.Min, range.Max, 0, 0), width, 0, bins, 1, counts);
+        const int below   = counts[bins];
+        const int counted = count - below - counts[bins + 1];
+
+        bin_counts.resize(bins);
+        max_count = 0;
+        for (int b = 0; b < bins; ++b) {
+            bin_counts[b] = counts[b];
             if (bin_counts[b] > max_count)
                 max_count = bin_counts[b];
-            counted++;
-        }
-        else if (val < range.Min) {
-            below++;
-        }
-    }
-    if (cumulative && density) {
-        if (outliers)
-            bin_counts[0] += below;
-        for (int b = 1; b < bins; ++b)
-            bin_counts[b] += bin_counts[b-1];
-        double scale = 1.0 / (outliers ? count : counted);
-        for (int b = 0; b < bins; ++b)
-            bin_counts[b] *= scale;
-        max_count = bin_counts[bins-1];
-    }
-    else if (cumulative) {
-        if (outliers)
-            bin_counts[0] += below;
-        for (int b = 1; b < bins; ++b)
-            bin_counts[b] += bin_counts[b-1];
-        max_count = bin_counts[bins-1];
-    }
-    else if (density) {
-        double scale = 1.0 / ((outliers ? count : counted) * width);
-        for (int b = 0; b < bins; ++b)
-            bin_counts[b] *= scale;
-        max_count *= scale;
+        }
+        if (cumulative && density) {
+            if (outliers)
+                bin_counts[0] += below;
+            for (int b = 1; b < bins; ++b)
+                bin_counts[b] += bin_counts[b-1];
+            double scale = 1.0 / (outliers ? count : counted);
+            for (int b = 0; b < bins; ++b)
+                bin_counts[b] *= scale;
+            max_count = bin_counts[bins-1];
+        }
+        else if (cumulative) {
+            if (outliers)
+                bin_counts[0] += below;
+            for (int b = 1; b < bins; ++b)
+                bin_counts[b] += bin_counts[b-1];
+            max_count = bin_counts[bins-1];
+        }
+        else if (density) {
+            double scale = 1.0 / ((outliers ? count : counted) * width);
+            for (int b = 0; b < bins; ++b)
+                bin_counts[b] *= scale;
+            max_count *= scale;
+        }
+
+        if (uncached) {
+            uncached->Range.X  = range;
+            uncached->XBins    = bins;
+            uncached->YBins    = 1;
+            uncached->Width    = width;
+            uncached->Height   = 0;
+            uncached->MaxCount = max_count;
+            uncached->Counts   = bin_counts;
+        }
     }
+
+    bin_centers.resize(bins);
+    for (int b = 0; b < bins; ++b)
+        bin_centers[b] = range.Min + b * width + width * 0.5;
+
+    // the bins are in temp buffers, the bars can't be deferred
+    gp.ParallelRenderLock++;
     if (ImHasFlag(flags, ImPlotHistogramFlags_Horizontal))
         PlotBars(label_id, &bin_counts.Data[0], &bin_centers.Data[0], bins, bar_scale*width, ImPlotBarsFlags_Horizontal);
     else
         PlotBars(label_id, &bin_centers.Data[0], &bin_counts.Data[0], bins, bar_scale*width);
+    gp.ParallelRenderLock--;
     return max_count;
 }
 #define INSTANTIATE_MACRO(T) template IMPLOT_API double PlotHistogram<T>(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags);
@@ -2598,56 +3815,85 @@ double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count
     if (count <= 0 || x_bins == 0 || y_bins == 0)
         return 0;
 
-    if (range.X.Min == 0 && range.X.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(xs, count, &Min, &Max);
-        range.X.Min = (double)Min;
-        range.X.Max = (double)Max;
-    }
-    if (range.Y.Min == 0 && range.Y.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(ys, count, &Min, &Max);
-        range.Y.Min = (double)Min;
-        range.Y.Max = (double)Max;
-    }
-
-    double width, height;
-    if (x_bins < 0)
-        CalculateBins(xs, count, x_bins, range.X, x_bins, width);
-    else
-        width = range.X.Size() / x_bins;
-    if (y_bins < 0)
-        CalculateBins(ys, count, y_bins, range.Y, y_bins, height);
-    else
-        height = range.Y.Size() / y_bins;
-
-    const int bins = x_bins * y_bins;
-
     ImPlotContext& gp = *GImPlot;
     ImVector<double>& bin_counts = gp.TempDouble1;
-    bin_counts.resize(bins);
+    double max_count;
+
+    ImPlotHistogramCache* cached = nullptr;
+    ImPlotHistogramCache* uncached = nullptr;
+    if (ImHasFlag(flags, ImPlotHistogramFlags_Cache)) {
+        ImPlotHistogramKey key;
+        key.Xs       = xs;
+        key.Ys       = ys;
+        key.Count    = count;
+        key.XBins    = x_bins;
+        key.YBins    = y_bins;
+        key.Flags    = flags;
+        key.TypeSize = sizeof(T);
+        key.Range    = range;
+        cached = GetHistogramCache(key, &uncached);
+    }
+
+    if (cached) {
+        range      = cached->Range;
+        x_bins     = cached->XBins;
+        y_bins     = cached->YBins;
+        max_count  = cached->MaxCount;
+        bin_counts = cached->Counts;
+    }
+    else {
+        if (range.X.Min == 0 && range.X.Max == 0) {
+            T Min, Max;
+            HistogramMinMax(xs, count, &Min, &Max);
+            range.X.Min = (double)Min;
+            range.X.Max = (double)Max;
+        }
+        if (range.Y.Min == 0 && range.Y.Max == 0) {
+            T Min, Max;
+            HistogramMinMax(ys, count, &Min, &Max);
+            range.Y.Min = (double)Min;
+            range.Y.Max = (double)Max;
+        }
+
+        double width, height;
+        if (x_bins < 0)
+            CalculateBins(xs, count, x_bins, range.X, x_bins, width);
+        else
+            width = range.X.Size() / x_bins;
+        if (y_bins < 0)
+            CalculateBins(ys, count, y_bins, range.Y, y_bins, height);
+        else
+            height = range.Y.Size() / y_bins;
 
-    for (int b = 0; b < bins; ++b)
-        bin_counts[b] = 0;
+        const int bins = x_bins * y_bins;
 
-    int counted = 0;
-    double max_count = 0;
-    for (int i = 0; i < count; ++i) {
-        if (range.Contains((double)xs[i], (double)ys[i])) {
-            const int xb = ImClamp( (int)((double)(xs[i] - range.X.Min) / width)  , 0, x_bins - 1);
-            const int yb = ImClamp( (int)((double)(ys[i] - range.Y.Min) / height) , 0, y_bins - 1);
-            const int b  = yb * x_bins + xb;
-            bin_counts[b] += 1.0;
+        ImVector<int>& counts = gp.TempInt1;
+        BinHistogram(xs, ys, count, range, width, height, x_bins, y_bins, counts);
+        const int counted = count - counts[bins];
+
+        bin_counts.resize(bins);
+        max_count = 0;
+        for (int b = 0; b < bins; ++b) {
+            bin_counts[b] = counts[b];
             if (bin_counts[b] > max_count)
                 max_count = bin_counts[b];
-            counted++;
         }
-    }
-    if (density) {
-        double scale = 1.0 / ((outliers ? count : counted) * width * height);
-        for (int b = 0; b < bins; ++b)
-            bin_counts[b] *= scale;
-        max_count *= scale;
+        if (density) {
+            double scale = 1.0 / ((outliers ? count : counted) * width * height);
+            for (int b = 0; b < bins; ++b)
+                bin_counts[b] *= scale;
+            max_count *= scale;
+        }
+
+        if (uncached) {
+            uncached->Range    = range;
+            uncached->XBins    = x_bins;
+            uncached->YBins    = y_bins;
+            uncached->Width    = width;
+            uncached->Height   = height;
+            uncached->MaxCount = max_count;
+            uncached->Counts   = bin_counts;
+        }
     }
 
     if (BeginItemEx(label_id, FitterRect(range))) {
@@ -2656,7 +3902,10 @@ double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count
             return max_count;
         }
         ImDrawList& draw_list = *GetPlotDrawList();
+        // the bins are in a temp buffer, the heatmap can't be deferred
+        gp.ParallelRenderLock++;
         RenderHeatmap(draw_list, &bin_counts.Data[0], y_bins, x_bins, 0, max_count, nullptr, range.Min(), range.Max(), false, col_maj);
+        gp.ParallelRenderLock--;
         EndItem();
     }
     return max_count;
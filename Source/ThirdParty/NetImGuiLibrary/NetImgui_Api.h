@@ -101,6 +101,21 @@
 	#define NETIMGUI_IMGUI_CALLBACK_ENABLED		(IMGUI_VERSION_NUM >= 18100)	// Not supported pre Dear ImGui 1.81
 #endif
 
+//-------------------------------------------------------------------------------------------------
+// Profiling hooks, for the library user to time the DrawFrame conversion/compression and to
+// count the bytes sent to the Server.
+// Note:	'NETIMGUI_PROFILE_SCOPE' is placed at the top of a function, with a 'ConvertDrawFrame' or
+//			'CompressDrawFrame' identifier. 'NETIMGUI_PROFILE_DATA_SENT' is called from the
+//			Communication thread.
+//-------------------------------------------------------------------------------------------------
+#ifndef NETIMGUI_PROFILE_SCOPE
+	#define NETIMGUI_PROFILE_SCOPE(Name)
+#endif
+
+#ifndef NETIMGUI_PROFILE_DATA_SENT
+	#define NETIMGUI_PROFILE_DATA_SENT(Size)
+#endif
+
 
 namespace NetImgui 
 { 
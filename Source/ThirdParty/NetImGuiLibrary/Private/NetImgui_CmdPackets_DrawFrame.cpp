@@ -35,9 +35,36 @@ TInt PointerCast(TPointer* pointer)
 //=================================================================================================
 // 
 //=================================================================================================
-inline void ImGui_ExtractIndices(const ImDrawList& cmdList, ImguiDrawGroup& drawGroupOut, ComDataType*& pDataOutput)
+inline void ImGui_ExtractIndices(const ImDrawList& cmdList, ImguiDrawGroup& drawGroupOut, ImVector<uint32_t>& vtxRebaseOut, ComDataType*& pDataOutput)
 {
 	bool is16Bit					= sizeof(ImDrawIdx) == 2 || cmdList.VtxBuffer.size() <= 0xFFFF;	// When Dear Imgui is compiled with ImDrawIdx = uint16, we know for certain that there won't be any drawcall with index > 65k, even if Vertex buffer is bigger than 65k.
+	bool isRebased					= false;
+	vtxRebaseOut.resize(cmdList.CmdBuffer.size());
+	memset(vtxRebaseOut.Data, 0, static_cast<size_t>(vtxRebaseOut.size()) * sizeof(uint32_t));
+
+	// With 32bits ImDrawIdx, big draw lists can still use 16bits indices when each drawcall references less than 65k vertices,
+	// by moving the lowest index of each drawcall into its vertex offset
+	if( !is16Bit )
+	{
+		isRebased = true;
+		for(int cmd_i = 0; cmd_i < cmdList.CmdBuffer.size() && isRebased; ++cmd_i)
+		{
+			const ImDrawCmd& cmd = cmdList.CmdBuffer[cmd_i];
+			if( cmd.UserCallback == nullptr && cmd.ElemCount > 0 )
+			{
+				uint32_t idxMin(0xFFFFFFFF), idxMax(0);
+				for(unsigned int i(cmd.IdxOffset); i < cmd.IdxOffset + cmd.ElemCount; ++i)
+				{
+					idxMin = cmdList.IdxBuffer[static_cast<int>(i)] < idxMin ? cmdList.IdxBuffer[static_cast<int>(i)] : idxMin;
+					idxMax = cmdList.IdxBuffer[static_cast<int>(i)] > idxMax ? cmdList.IdxBuffer[static_cast<int>(i)] : idxMax;
+				}
+				vtxRebaseOut[cmd_i] = idxMin;
+				isRebased			= idxMax - idxMin <= 0xFFFF;
+			}
+		}
+		is16Bit = isRebased;
+	}
+
 	drawGroupOut.mBytePerIndex		= is16Bit ? 2 : 4;
 	drawGroupOut.mIndiceCount		= static_cast<uint32_t>(cmdList.IdxBuffer.size());
 	uint32_t sizeNeeded				= drawGroupOut.mIndiceCount*drawGroupOut.mBytePerIndex;
@@ -46,8 +73,19 @@ inline void ImGui_ExtractIndices(const ImDrawList& cmdList, ImguiDrawGroup& draw
 	// No conversion needed, straight copy
 	if( drawGroupOut.mBytePerIndex == sizeof(ImDrawIdx) )
 	{
+		memset(vtxRebaseOut.Data, 0, static_cast<size_t>(vtxRebaseOut.size()) * sizeof(uint32_t));
 		memcpy(drawGroupOut.mpIndices.Get(), &cmdList.IdxBuffer.front(), sizeNeeded);
 	}
+	// From 32bits to 16bits, relative to each drawcall lowest index
+	else if(isRebased)
+	{
+		for(int cmd_i = 0; cmd_i < cmdList.CmdBuffer.size(); ++cmd_i)
+		{
+			const ImDrawCmd& cmd = cmdList.CmdBuffer[cmd_i];
+			for(unsigned int i(cmd.IdxOffset); i < cmd.IdxOffset + cmd.ElemCount; ++i)
+				reinterpret_cast<uint16_t*>(drawGroupOut.mpIndices.Get())[i] = static_cast<uint16_t>(cmdList.IdxBuffer[static_cast<int>(i)] - vtxRebaseOut[cmd_i]);
+		}
+	}
 	// From 32bits to 16bits
 	else if(is16Bit)
 	{
@@ -86,7 +124,7 @@ inline void ImGui_ExtractVertices(const ImDrawList& cmdList, ImguiDrawGroup& dra
 //=================================================================================================
 // 
 //=================================================================================================
-inline void ImGui_ExtractDraws(const ImDrawList& cmdList, ImguiDrawGroup& drawGroupOut, ComDataType*& pDataOutput)
+inline void ImGui_ExtractDraws(const ImDrawList& cmdList, ImguiDrawGroup& drawGroupOut, const ImVector<uint32_t>& vtxRebase, ComDataType*& pDataOutput)
 {
 	int maxDrawCount		= static_cast<int>(cmdList.CmdBuffer.size());
 	uint32_t drawCount		= 0;
@@ -97,10 +135,10 @@ inline void ImGui_ExtractDraws(const ImDrawList& cmdList, ImguiDrawGroup& drawGr
 		if( pCmd->UserCallback == nullptr )
 		{
 		#if IMGUI_VERSION_NUM >= 17100
-			pOutDraws[drawCount].mVtxOffset		= pCmd->VtxOffset;
+			pOutDraws[drawCount].mVtxOffset		= pCmd->VtxOffset + vtxRebase[cmd_i];
 			pOutDraws[drawCount].mIdxOffset		= pCmd->IdxOffset;
 		#else
-			pOutDraws[drawCount].mVtxOffset		= 0;
+			pOutDraws[drawCount].mVtxOffset		= vtxRebase[cmd_i];
 			pOutDraws[drawCount].mIdxOffset		= 0;
 		#endif
 			
@@ -200,6 +238,8 @@ void DecompressData(const ComDataType* pDataPrev, size_t dataSizePrev, const Com
 //=================================================================================================
 CmdDrawFrame* CompressCmdDrawFrame(const CmdDrawFrame* pDrawFramePrev, const CmdDrawFrame* pDrawFrameNew)
 {
+	NETIMGUI_PROFILE_SCOPE(CompressDrawFrame);
+
 	//-----------------------------------------------------------------------------------------
 	// Allocate memory for the new compressed command
 	//-----------------------------------------------------------------------------------------
@@ -323,6 +363,8 @@ CmdDrawFrame* DecompressCmdDrawFrame(const CmdDrawFrame* pDrawFramePrev, const C
 //=================================================================================================
 CmdDrawFrame* ConvertToCmdDrawFrame(const ImDrawData* pDearImguiData, ImGuiMouseCursor mouseCursor)
 {
+	NETIMGUI_PROFILE_SCOPE(ConvertDrawFrame);
+
 	//-----------------------------------------------------------------------------------------
 	// Find memory needed for entire DrawFrame Command
 	//-----------------------------------------------------------------------------------------
@@ -356,15 +398,16 @@ CmdDrawFrame* ConvertToCmdDrawFrame(const ImDrawData* pDearImguiData, ImGuiMouse
 	//-----------------------------------------------------------------------------------------
 
 
+	ImVector<uint32_t> vtxRebase;	// Vertex offset added to each drawcall of a draw list
 	for(size_t n = 0; n < pDrawFrame->mDrawGroupCount; n++)
 	{
 		ImguiDrawGroup& drawGroup		= pDrawFrame->mpDrawGroups[n];
 		const ImDrawList* pCmdList		= pDearImguiData->CmdLists[static_cast<int>(n)];
 		drawGroup						= ImguiDrawGroup();
 		drawGroup.mGroupID				= PointerCast<uint64_t>(pCmdList->_OwnerName); // Use the name string pointer as a unique ID (seems to remain the same between frame)
-		ImGui_ExtractIndices(*pCmdList,	drawGroup, pDataOutput);
+		ImGui_ExtractIndices(*pCmdList,	drawGroup, vtxRebase, pDataOutput);
 		ImGui_ExtractVertices(*pCmdList,drawGroup, pDataOutput);
-		ImGui_ExtractDraws(*pCmdList,	drawGroup, pDataOutput);
+		ImGui_ExtractDraws(*pCmdList,	drawGroup, vtxRebase, pDataOutput);
 		pDrawFrame->mTotalVerticeCount	+= drawGroup.mVerticeCount;
 		pDrawFrame->mTotalIndiceCount	+= drawGroup.mIndiceCount;
 		pDrawFrame->mTotalDrawCount		+= drawGroup.mDrawCount;
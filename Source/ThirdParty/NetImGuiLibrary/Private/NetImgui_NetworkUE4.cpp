@@ -131,6 +131,7 @@ bool DataSend(SocketInfo* pClientSocket, void* pDataOut, size_t Size)
 {
 	int32 sizeSent(0);
 	bool bResult = pClientSocket->mpSocket->Send(reinterpret_cast<uint8*>(pDataOut), Size, sizeSent);
+	NETIMGUI_PROFILE_DATA_SENT(static_cast<size_t>(sizeSent));
 	return bResult && static_cast<int32>(Size) == sizeSent;
 }
 
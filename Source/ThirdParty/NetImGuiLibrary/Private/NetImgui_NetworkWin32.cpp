@@ -133,6 +133,9 @@ bool DataReceive(SocketInfo* pClientSocket, void* pDataIn, size_t Size)
 bool DataSend(SocketInfo* pClientSocket, void* pDataOut, size_t Size)
 {
 	int resultSend = send(pClientSocket->mSocket, reinterpret_cast<char*>(pDataOut), static_cast<int>(Size), 0);
+	if( resultSend > 0 ){
+		NETIMGUI_PROFILE_DATA_SENT(static_cast<size_t>(resultSend));
+	}
 	return resultSend != SOCKET_ERROR && static_cast<int>(Size) == resultSend;
 }
 
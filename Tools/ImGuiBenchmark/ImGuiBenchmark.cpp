@@ -0,0 +1,845 @@
+// Headless benchmark of the vendored ImGui and ImPlot sources, built outside of Unreal to catch performance regressions
+// when updating them. Each scene runs in fresh contexts with a null renderer, a fixed 60 Hz clock and a scripted mouse,
+// so runs only differ by timing. Results are written as JSON.
+//
+//	cmake -S Tools/ImGuiBenchmark -B Build/ImGuiBenchmark && cmake --build Build/ImGuiBenchmark
+//	Build/ImGuiBenchmark/ImGuiBenchmark --frames 300 --warmup 30 --scene plot_line_1m,heatmap_1024 --out results.json
+//
+// --check compares the draw data of the subplots scene rendered with and without ImPlotSubplotFlags_ParallelRender, which
+// must be identical, and exits with 1 if it isn't. CTest runs it.
+
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <implot.h>
+#include <implot_internal.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	/// Allocations made through ImGui's allocator, which ImPlot also uses
+	uint64_t GAllocCount = 0;
+	uint64_t GAllocBytes = 0;
+
+	void* BenchmarkMalloc(size_t Size, void* UserData)
+	{
+		++GAllocCount;
+		GAllocBytes += Size;
+		return malloc(Size);
+	}
+
+	void BenchmarkFree(void* Ptr, void* UserData)
+	{
+		free(Ptr);
+	}
+
+	/// Runs ImPlot's tasks on all hardware threads like the plugin does on the task graph, the threads are started by every call
+	void BenchmarkParallelFor(int Count, void (*Func)(int Index, void* UserData), void* UserData)
+	{
+		std::atomic<int> NextIndex(0);
+		const auto Work = [&NextIndex, Count, Func, UserData]()
+		{
+			for (int Index = NextIndex++; Index < Count; Index = NextIndex++)
+			{
+				Func(Index, UserData);
+			}
+		};
+
+		const int ThreadCount = std::min(Count, static_cast<int>(std::max(std::thread::hardware_concurrency(), 1u)));
+		std::vector<std::thread> Threads;
+		for (int ThreadIdx = 1; ThreadIdx < ThreadCount; ++ThreadIdx)
+		{
+			Threads.emplace_back(Work);
+		}
+		Work();
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+	}
+
+	using FClock = std::chrono::steady_clock;
+
+	double ElapsedMs(FClock::time_point Start, FClock::time_point End)
+	{
+		return std::chrono::duration<double, std::milli>(End - Start).count();
+	}
+
+	/// Deterministic values for the scenes' data
+	struct FRandom
+	{
+		uint32_t State = 12345;
+
+		float Next()
+		{
+			State = State * 1664525u + 1013904223u;
+			return (State >> 8) * (1.0f / 16777216.0f);
+		}
+	};
+
+	constexpr float DisplayWidth = 1920.0f;
+	constexpr float DisplayHeight = 1080.0f;
+
+	/// Covers the display with a single undecorated window
+	bool BeginFullscreenWindow(const char* Name)
+	{
+		ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+		ImGui::SetNextWindowSize(ImVec2(DisplayWidth, DisplayHeight));
+		return ImGui::Begin(Name, nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoSavedSettings);
+	}
+
+	void DrawDemo(int Frame)
+	{
+		ImGui::ShowDemoWindow();
+		ImPlot::ShowDemoWindow();
+	}
+
+	constexpr int TableRowCount = 100000;
+
+	void DrawTable(int Frame)
+	{
+		if (BeginFullscreenWindow("Table"))
+		{
+			const ImGuiTableFlags Flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable;
+			if (ImGui::BeginTable("##Table", 5, Flags))
+			{
+				ImGui::TableSetupScrollFreeze(0, 1);
+				ImGui::TableSetupColumn("Id");
+				ImGui::TableSetupColumn("Name");
+				ImGui::TableSetupColumn("State");
+				ImGui::TableSetupColumn("Value");
+				ImGui::TableSetupColumn("Progress");
+				ImGui::TableHeadersRow();
+
+				// Scrolls through the whole table over a few hundred frames
+				ImGui::SetScrollY(std::fmod(Frame * 331.0f * ImGui::GetTextLineHeightWithSpacing(), TableRowCount * ImGui::GetTextLineHeightWithSpacing()));
+
+				ImGuiListClipper Clipper;
+				Clipper.Begin(TableRowCount);
+				while (Clipper.Step())
+				{
+					for (int Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; ++Row)
+					{
+						ImGui::TableNextRow();
+						ImGui::TableNextColumn();
+						ImGui::Text("%06d", Row);
+						ImGui::TableNextColumn();
+						ImGui::Text("Entity_%d", Row * 7919 % 100000);
+						ImGui::TableNextColumn();
+						ImGui::TextUnformatted((Row % 3 == 0) ? "Active" : (Row % 3 == 1) ? "Idle" : "Sleeping");
+						ImGui::TableNextColumn();
+						ImGui::Text("%.3f", Row * 0.137f);
+						ImGui::TableNextColumn();
+						ImGui::ProgressBar((Row % 100) / 100.0f, ImVec2(-1.0f, 0.0f));
+					}
+				}
+				ImGui::EndTable();
+			}
+		}
+		ImGui::End();
+	}
+
+	std::vector<float> LineValues;
+
+	void SetupPlotLine()
+	{
+		FRandom Random;
+		LineValues.resize(1000000);
+		for (size_t Idx = 0; Idx < LineValues.size(); ++Idx)
+		{
+			LineValues[Idx] = std::sin(Idx * 0.001f) + 0.25f * std::sin(Idx * 0.037f) + 0.1f * Random.Next();
+		}
+	}
+
+	void DrawPlotLine(int Frame)
+	{
+		if (BeginFullscreenWindow("Plot Line") && ImPlot::BeginPlot("##Line", ImVec2(-1.0f, -1.0f)))
+		{
+			ImPlot::SetupAxes("Sample", "Value", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+			ImPlot::PlotLine("Signal", LineValues.data(), static_cast<int>(LineValues.size()));
+			ImPlot::EndPlot();
+		}
+		ImGui::End();
+	}
+
+	constexpr int HeatmapSize = 1024;
+	std::vector<float> HeatmapValues;
+
+	void SetupHeatmap()
+	{
+		FRandom Random;
+		HeatmapValues.resize(HeatmapSize * HeatmapSize);
+		for (int Row = 0; Row < HeatmapSize; ++Row)
+		{
+			for (int Col = 0; Col < HeatmapSize; ++Col)
+			{
+				HeatmapValues[Row * HeatmapSize + Col] = std::sin(Row * 0.02f) * std::cos(Col * 0.03f) + 0.2f * Random.Next();
+			}
+		}
+	}
+
+	void DrawHeatmap(int Frame)
+	{
+		if (BeginFullscreenWindow("Heatmap") && ImPlot::BeginPlot("##Heatmap", ImVec2(-1.0f, -1.0f), ImPlotFlags_NoLegend))
+		{
+			ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoDecorations, ImPlotAxisFlags_NoDecorations);
+			ImPlot::PlotHeatmap("##Values", HeatmapValues.data(), HeatmapSize, HeatmapSize, -1.2, 1.2, nullptr);
+			ImPlot::EndPlot();
+		}
+		ImGui::End();
+	}
+
+	constexpr int TextLineCount = 5000;
+	std::vector<std::string> TextLines;
+
+	void SetupText()
+	{
+		char Line[128];
+		TextLines.resize(TextLineCount);
+		for (int LineIdx = 0; LineIdx < TextLineCount; ++LineIdx)
+		{
+			snprintf(Line, sizeof(Line), "[%05d] LogBenchmark: Entity_%d updated state %d in %.3f ms", LineIdx, LineIdx * 7919 % 1000, LineIdx % 13, (LineIdx % 97) * 0.137f);
+			TextLines[LineIdx] = Line;
+		}
+	}
+
+	void DrawText(int Frame)
+	{
+		// Unclipped like log windows that don't use ImGuiListClipper, every fourth line word-wrapped
+		if (BeginFullscreenWindow("Text"))
+		{
+			for (int LineIdx = 0; LineIdx < TextLineCount; ++LineIdx)
+			{
+				if (LineIdx % 4 == 0)
+				{
+					ImGui::PushTextWrapPos(300.0f);
+					ImGui::TextUnformatted(TextLines[LineIdx].c_str());
+					ImGui::PopTextWrapPos();
+				}
+				else
+				{
+					ImGui::TextUnformatted(TextLines[LineIdx].c_str());
+				}
+			}
+		}
+		ImGui::End();
+	}
+
+	constexpr int DockedWindowCount = 50;
+
+	void DrawDocking(int Frame)
+	{
+		const ImGuiID DockSpaceId = ImGui::DockSpaceOverViewport();
+
+		if (Frame == 0)
+		{
+			// 5 columns of 2 nodes, each with 5 tabs
+			ImGui::DockBuilderRemoveNodeChildNodes(DockSpaceId);
+			ImGui::DockBuilderSetNodeSize(DockSpaceId, ImVec2(DisplayWidth, DisplayHeight));
+
+			ImGuiID Nodes[10];
+			ImGuiID Remaining = DockSpaceId;
+			for (int Column = 0; Column < 5; ++Column)
+			{
+				ImGuiID ColumnNode = Remaining;
+				if (Column < 4)
+				{
+					ImGui::DockBuilderSplitNode(Remaining, ImGuiDir_Left, 1.0f / (5 - Column), &ColumnNode, &Remaining);
+				}
+				ImGui::DockBuilderSplitNode(ColumnNode, ImGuiDir_Up, 0.5f, &Nodes[Column * 2], &Nodes[Column * 2 + 1]);
+			}
+
+			char Name[32];
+			for (int WindowIdx = 0; WindowIdx < DockedWindowCount; ++WindowIdx)
+			{
+				snprintf(Name, sizeof(Name), "Window %d", WindowIdx);
+				ImGui::DockBuilderDockWindow(Name, Nodes[WindowIdx % 10]);
+			}
+			ImGui::DockBuilderFinish(DockSpaceId);
+		}
+
+		char Name[32];
+		for (int WindowIdx = 0; WindowIdx < DockedWindowCount; ++WindowIdx)
+		{
+			snprintf(Name, sizeof(Name), "Window %d", WindowIdx);
+			if (ImGui::Begin(Name))
+			{
+				ImGui::Text("Frame %d", Frame);
+				ImGui::Button("Button");
+				ImGui::SameLine();
+				static bool bChecked = false;
+				ImGui::Checkbox("Checkbox", &bChecked);
+				static float Value = 0.5f;
+				ImGui::SliderFloat("Slider", &Value, 0.0f, 1.0f);
+				for (int LineIdx = 0; LineIdx < 20; ++LineIdx)
+				{
+					ImGui::Text("Line %d of window %d", LineIdx, WindowIdx);
+				}
+			}
+			ImGui::End();
+		}
+	}
+
+	constexpr int SubplotPointCount = 20000;
+	constexpr int SubplotHeatmapSize = 64;
+	std::vector<float> SubplotXs;
+	std::vector<float> SubplotYs;
+	std::vector<float> SubplotHeatmapValues;
+
+	void SetupSubplots()
+	{
+		FRandom Random;
+		SubplotXs.resize(SubplotPointCount);
+		SubplotYs.resize(SubplotPointCount);
+		for (int Idx = 0; Idx < SubplotPointCount; ++Idx)
+		{
+			SubplotXs[Idx] = Idx * 0.01f;
+			SubplotYs[Idx] = std::sin(Idx * 0.01f) + 0.3f * Random.Next();
+		}
+
+		SubplotHeatmapValues.resize(SubplotHeatmapSize * SubplotHeatmapSize);
+		for (float& Value : SubplotHeatmapValues)
+		{
+			Value = Random.Next();
+		}
+	}
+
+	/// One plot per kind of item ImPlot can defer, with and without markers, the data scrolling every frame
+	void DrawSubplotItems(int Frame, bool bParallel)
+	{
+		if (BeginFullscreenWindow("Subplots"))
+		{
+			const ImPlotSubplotFlags Flags = bParallel ? ImPlotSubplotFlags_ParallelRender : ImPlotSubplotFlags_None;
+			if (ImPlot::BeginSubplots("##Subplots", 3, 3, ImVec2(-1.0f, -1.0f), Flags))
+			{
+				const int Offset = (Frame * 97) % SubplotPointCount;
+				const float* Xs = SubplotXs.data();
+				const float* Ys = SubplotYs.data();
+				const ImPlotAxisFlags AxisFlags = ImPlotAxisFlags_AutoFit;
+
+				if (ImPlot::BeginPlot("Lines"))
+				{
+					ImPlot::SetupAxes(nullptr, nullptr, AxisFlags, AxisFlags);
+					ImPlot::PlotLine("Line", Ys, SubplotPointCount, 1.0, 0.0, ImPlotLineFlags_None, Offset);
+					ImPlot::SetNextMarkerStyle(ImPlotMarker_Circle, 3.0f);
+					ImPlot::PlotLine("Markers", Xs, Ys, 200, ImPlotLineFlags_None, Offset);
+					ImPlot::EndPlot();
+				}
+
+				if (ImPlot::BeginPlot("Scatter"))
+				{
+					ImPlot::SetupAxes(nullptr, nullptr, AxisFlags, AxisFlags);
+					ImPlot::PlotScatter("Circles", Xs, Ys, 2000, ImPlotScatterFlags_None, Offset);
+					ImPlot::SetNextMarkerStyle(ImPlotMarker_Square, 5.0f, ImVec4(1.0f, 0.5f, 0.0f, 1.0f), 1.5f);
+					ImPlot::PlotScatter("Squares", Ys, 300, 1.0, 0.0, ImPlotScatterFlags_None, Offset);
+					ImPlot::EndPlot();
+				}
+
+				if (ImPlot::BeginPlot("Shaded"))
+				{
+					ImPlot::SetupAxes(nullptr, nullptr, AxisFlags, AxisFlags);
+					ImPlot::PlotShaded("Reference", Xs, Ys, 5000, 0.0, ImPlotShadedFlags_None, Offset);
+					ImPlot::PlotShaded("Band", Xs, Ys, Ys + 1, 5000, ImPlotShadedFlags_None, Offset);
+					ImPlot::EndPlot();
+				}
+
+				if (ImPlot::BeginPlot("Bars"))
+				{
+					ImPlot::SetupAxes(nullptr, nullptr, AxisFlags, AxisFlags);
+					ImPlot::PlotBars("Vertical", Ys, 100, 0.67, 0.0, ImPlotBarsFlags_None, Offset);
+					ImPlot::PlotBars("Horizontal", Ys, 50, 0.5, 0.0, ImPlotBarsFlags_Horizontal, Offset);
+					ImPlot::EndPlot();
+				}
+
+				if (ImPlot::BeginPlot("Stairs"))
+				{
+					ImPlot::SetupAxes(nullptr, nullptr, AxisFlags, AxisFlags);
+					ImPlot::PlotStairs("Pre", Ys, 500, 1.0, 0.0, ImPlotStairsFlags_PreStep, Offset);
+					ImPlot::PlotStairs("Shaded", Ys, 500, 1.0, 0.0, ImPlotStairsFlags_Shaded, Offset);
+					ImPlot::SetNextMarkerStyle(ImPlotMarker_Diamond, 4.0f);
+					ImPlot::PlotStairs("Markers", Ys, 50, 1.0, 0.0, ImPlotStairsFlags_None, Offset);
+					ImPlot::EndPlot();
+				}
+
+				if (ImPlot::BeginPlot("Histogram"))
+				{
+					ImPlot::SetupAxes(nullptr, nullptr, AxisFlags, AxisFlags);
+					ImPlot::PlotHistogram("Values", Ys + Offset % 1000, SubplotPointCount - 1000, 64);
+					ImPlot::EndPlot();
+				}
+
+				if (ImPlot::BeginPlot("Heatmap", ImVec2(-1.0f, 0.0f), ImPlotFlags_NoLegend))
+				{
+					ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoDecorations, ImPlotAxisFlags_NoDecorations);
+					ImPlot::PlotHeatmap("Values", SubplotHeatmapValues.data(), SubplotHeatmapSize, SubplotHeatmapSize, 0.0, 1.0, nullptr);
+					ImPlot::PlotHeatmap("Labeled", SubplotHeatmapValues.data(), 4, 4, 0.0, 1.0, "%.2f", ImPlotPoint(0.0, 0.0), ImPlotPoint(0.25, 0.25), ImPlotHeatmapFlags_ColMajor);
+					ImPlot::EndPlot();
+				}
+
+				if (ImPlot::BeginPlot("Stems"))
+				{
+					ImPlot::SetupAxes(nullptr, nullptr, AxisFlags, AxisFlags);
+					ImPlot::PlotStems("Stems", Ys, 100, 0.0, 1.0, 0.0, ImPlotStemsFlags_None, Offset);
+					ImPlot::SetNextMarkerStyle(ImPlotMarker_None);
+					ImPlot::PlotStems("No Markers", Ys, 100, 0.5, 1.0, 0.0, ImPlotStemsFlags_Horizontal, Offset);
+					ImPlot::EndPlot();
+				}
+
+				if (ImPlot::BeginPlot("Text"))
+				{
+					ImPlot::SetupAxes(nullptr, nullptr, AxisFlags, AxisFlags);
+					ImPlot::PlotLine("Line", Ys, 1000, 1.0, 0.0, ImPlotLineFlags_None, Offset);
+					ImPlot::PlotText("Start", 0.0, Ys[Offset]);
+					ImPlot::PlotText("Vertical", 500.0, 0.0, ImVec2(0.0f, 0.0f), ImPlotTextFlags_Vertical);
+					ImPlot::EndPlot();
+				}
+
+				ImPlot::EndSubplots();
+			}
+		}
+		ImGui::End();
+	}
+
+	void DrawSubplots(int Frame)
+	{
+		DrawSubplotItems(Frame, false);
+	}
+
+	void DrawSubplotsParallel(int Frame)
+	{
+		ImPlot::SetParallelFor(BenchmarkParallelFor);
+		DrawSubplotItems(Frame, true);
+	}
+
+	struct FScene
+	{
+		const char* Name;
+		void (*Setup)();
+		void (*Draw)(int Frame);
+	};
+
+	const FScene Scenes[] = {
+		{ "demo", nullptr, DrawDemo },
+		{ "table_100k", nullptr, DrawTable },
+		{ "plot_line_1m", SetupPlotLine, DrawPlotLine },
+		{ "heatmap_1024", SetupHeatmap, DrawHeatmap },
+		{ "text_heavy", SetupText, DrawText },
+		{ "docking_50", nullptr, DrawDocking },
+		{ "subplots", SetupSubplots, DrawSubplots },
+		{ "subplots_parallel", SetupSubplots, DrawSubplotsParallel }
+	};
+
+	struct FTimings
+	{
+		double Mean = 0.0;
+		double P50 = 0.0;
+		double P99 = 0.0;
+		double Max = 0.0;
+	};
+
+	FTimings ComputeTimings(std::vector<double> Samples)
+	{
+		FTimings Timings;
+		if (Samples.empty())
+		{
+			return Timings;
+		}
+
+		std::sort(Samples.begin(), Samples.end());
+		for (const double Sample : Samples)
+		{
+			Timings.Mean += Sample;
+		}
+		Timings.Mean /= Samples.size();
+
+		// Nearest-rank percentiles
+		const auto Percentile = [&Samples](double P)
+		{
+			const size_t Rank = static_cast<size_t>(std::ceil(P / 100.0 * Samples.size()));
+			return Samples[std::min(std::max<size_t>(Rank, 1), Samples.size()) - 1];
+		};
+		Timings.P50 = Percentile(50.0);
+		Timings.P99 = Percentile(99.0);
+		Timings.Max = Samples.back();
+		return Timings;
+	}
+
+	struct FSceneResult
+	{
+		const char* Name = nullptr;
+		FTimings NewFrame;
+		FTimings Widgets;
+		FTimings Render;
+		FTimings Frame;
+		double Vertices = 0.0;
+		double Indices = 0.0;
+		double Commands = 0.0;
+		double DrawLists = 0.0;
+		double Allocations = 0.0;
+		double AllocatedBytes = 0.0;
+	};
+
+	/// Same setup as FImGuiContext::Initialize and BeginFrame, without the platform backend
+	void InitializeIO(ImGuiIO& IO)
+	{
+		IO.IniFilename = nullptr;
+		IO.LogFilename = nullptr;
+		IO.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard | ImGuiConfigFlags_DockingEnable;
+		IO.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+		IO.DisplaySize = ImVec2(DisplayWidth, DisplayHeight);
+		IO.DeltaTime = 1.0f / 60.0f;
+	}
+
+	/// Builds the fonts and marker sprites of an atlas, like FImGuiFontAtlas::Build
+	void BuildFontAtlas(ImFontAtlas* Atlas, ImPlotMarkerSprites& MarkerSprites)
+	{
+		Atlas->AddFontDefault();
+		ImPlot::AddMarkerSprites(Atlas, MarkerSprites);
+		unsigned char* Pixels;
+		int Width, Height;
+		Atlas->GetTexDataAsRGBA32(&Pixels, &Width, &Height);
+		ImPlot::BuildMarkerSprites(Atlas, MarkerSprites);
+		Atlas->SetTexID(reinterpret_cast<ImTextureID>(static_cast<intptr_t>(1)));
+	}
+
+	/// Mouse circling the display center, hovering widgets and plots without clicking
+	void AddMousePos(ImGuiIO& IO, int Frame)
+	{
+		const float Angle = Frame * 0.05f;
+		IO.AddMousePosEvent(DisplayWidth * 0.5f + 400.0f * std::cos(Angle), DisplayHeight * 0.5f + 300.0f * std::sin(Angle));
+	}
+
+	FSceneResult RunScene(const FScene& Scene, int WarmupFrames, int Frames)
+	{
+		if (Scene.Setup)
+		{
+			Scene.Setup();
+		}
+
+		ImGuiContext* Context = ImGui::CreateContext();
+		ImPlotContext* PlotContext = ImPlot::CreateContext();
+
+		ImGuiIO& IO = ImGui::GetIO();
+		InitializeIO(IO);
+		BuildFontAtlas(IO.Fonts, PlotContext->MarkerSprites);
+
+		std::vector<double> NewFrameMs, WidgetsMs, RenderMs, FrameMs;
+		FSceneResult Result;
+		Result.Name = Scene.Name;
+
+		for (int Frame = 0; Frame < WarmupFrames + Frames; ++Frame)
+		{
+			AddMousePos(IO, Frame);
+
+			const uint64_t AllocCount = GAllocCount;
+			const uint64_t AllocBytes = GAllocBytes;
+
+			const FClock::time_point StartTime = FClock::now();
+			ImGui::NewFrame();
+			const FClock::time_point NewFrameTime = FClock::now();
+			Scene.Draw(Frame);
+			const FClock::time_point WidgetsTime = FClock::now();
+			ImGui::Render();
+			const FClock::time_point RenderTime = FClock::now();
+
+			if (Frame < WarmupFrames)
+			{
+				continue;
+			}
+
+			NewFrameMs.push_back(ElapsedMs(StartTime, NewFrameTime));
+			WidgetsMs.push_back(ElapsedMs(NewFrameTime, WidgetsTime));
+			RenderMs.push_back(ElapsedMs(WidgetsTime, RenderTime));
+			FrameMs.push_back(ElapsedMs(StartTime, RenderTime));
+
+			const ImDrawData* DrawData = ImGui::GetDrawData();
+			Result.Vertices += DrawData->TotalVtxCount;
+			Result.Indices += DrawData->TotalIdxCount;
+			Result.DrawLists += DrawData->CmdListsCount;
+			for (const ImDrawList* DrawList : DrawData->CmdLists)
+			{
+				Result.Commands += DrawList->CmdBuffer.Size;
+			}
+			Result.Allocations += static_cast<double>(GAllocCount - AllocCount);
+			Result.AllocatedBytes += static_cast<double>(GAllocBytes - AllocBytes);
+		}
+
+		ImPlot::DestroyContext(PlotContext);
+		ImGui::DestroyContext(Context);
+
+		Result.NewFrame = ComputeTimings(NewFrameMs);
+		Result.Widgets = ComputeTimings(WidgetsMs);
+		Result.Render = ComputeTimings(RenderMs);
+		Result.Frame = ComputeTimings(FrameMs);
+
+		const double FrameCount = std::max(Frames, 1);
+		Result.Vertices /= FrameCount;
+		Result.Indices /= FrameCount;
+		Result.Commands /= FrameCount;
+		Result.DrawLists /= FrameCount;
+		Result.Allocations /= FrameCount;
+		Result.AllocatedBytes /= FrameCount;
+		return Result;
+	}
+
+	/// Returns the first difference between the draw data of two frames, empty if they are identical
+	std::string CompareDrawData(const ImDrawData& Expected, const ImDrawData& Actual)
+	{
+		char Message[256];
+		if (Expected.CmdListsCount != Actual.CmdListsCount)
+		{
+			snprintf(Message, sizeof(Message), "%d draw lists instead of %d", Actual.CmdListsCount, Expected.CmdListsCount);
+			return Message;
+		}
+
+		for (int ListIdx = 0; ListIdx < Expected.CmdListsCount; ++ListIdx)
+		{
+			const ImDrawList& ExpectedList = *Expected.CmdLists[ListIdx];
+			const ImDrawList& ActualList = *Actual.CmdLists[ListIdx];
+			const char* Name = ExpectedList._OwnerName ? ExpectedList._OwnerName : "?";
+
+			if (ExpectedList.VtxBuffer.Size != ActualList.VtxBuffer.Size || ExpectedList.IdxBuffer.Size != ActualList.IdxBuffer.Size || ExpectedList.CmdBuffer.Size != ActualList.CmdBuffer.Size)
+			{
+				snprintf(Message, sizeof(Message), "draw list %s has %d vertices, %d indices and %d commands instead of %d, %d and %d", Name,
+					ActualList.VtxBuffer.Size, ActualList.IdxBuffer.Size, ActualList.CmdBuffer.Size,
+					ExpectedList.VtxBuffer.Size, ExpectedList.IdxBuffer.Size, ExpectedList.CmdBuffer.Size);
+				return Message;
+			}
+
+			if (memcmp(ExpectedList.VtxBuffer.Data, ActualList.VtxBuffer.Data, ExpectedList.VtxBuffer.size_in_bytes()) != 0)
+			{
+				snprintf(Message, sizeof(Message), "draw list %s has different vertices", Name);
+				return Message;
+			}
+
+			if (memcmp(ExpectedList.IdxBuffer.Data, ActualList.IdxBuffer.Data, ExpectedList.IdxBuffer.size_in_bytes()) != 0)
+			{
+				snprintf(Message, sizeof(Message), "draw list %s has different indices", Name);
+				return Message;
+			}
+
+			for (int CmdIdx = 0; CmdIdx < ExpectedList.CmdBuffer.Size; ++CmdIdx)
+			{
+				const ImDrawCmd& ExpectedCmd = ExpectedList.CmdBuffer[CmdIdx];
+				const ImDrawCmd& ActualCmd = ActualList.CmdBuffer[CmdIdx];
+				if (memcmp(&ExpectedCmd.ClipRect, &ActualCmd.ClipRect, sizeof(ImVec4)) != 0 || ExpectedCmd.TextureId != ActualCmd.TextureId ||
+					ExpectedCmd.VtxOffset != ActualCmd.VtxOffset || ExpectedCmd.IdxOffset != ActualCmd.IdxOffset || ExpectedCmd.ElemCount != ActualCmd.ElemCount ||
+					ExpectedCmd.UserCallback != ActualCmd.UserCallback || ExpectedCmd.UserCallbackData != ActualCmd.UserCallbackData)
+				{
+					snprintf(Message, sizeof(Message), "command %d of draw list %s differs", CmdIdx, Name);
+					return Message;
+				}
+			}
+		}
+
+		return std::string();
+	}
+
+	/// Draws the subplots scene in two contexts, with and without parallel rendering, and compares their draw data
+	bool CheckParallelRender(int Frames)
+	{
+		SetupSubplots();
+
+		ImFontAtlas Atlas;
+		ImGuiContext* Contexts[2];
+		ImPlotContext* PlotContexts[2];
+		for (int ContextIdx = 0; ContextIdx < 2; ++ContextIdx)
+		{
+			Contexts[ContextIdx] = ImGui::CreateContext(&Atlas);
+			PlotContexts[ContextIdx] = ImPlot::CreateContext();
+			// Creating a context only makes it current when there is none
+			ImGui::SetCurrentContext(Contexts[ContextIdx]);
+			InitializeIO(ImGui::GetIO());
+		}
+
+		// Marker sprites are copied into every context drawing with the atlas, like FImGuiFontAtlas::ApplyMarkerSprites
+		ImPlotMarkerSprites MarkerSprites;
+		BuildFontAtlas(&Atlas, MarkerSprites);
+		for (int ContextIdx = 0; ContextIdx < 2; ++ContextIdx)
+		{
+			PlotContexts[ContextIdx]->MarkerSprites = MarkerSprites;
+		}
+
+		int FailedFrame = -1;
+		for (int Frame = 0; Frame < Frames && FailedFrame < 0; ++Frame)
+		{
+			for (int ContextIdx = 0; ContextIdx < 2; ++ContextIdx)
+			{
+				ImGui::SetCurrentContext(Contexts[ContextIdx]);
+				ImPlot::SetCurrentContext(PlotContexts[ContextIdx]);
+				AddMousePos(ImGui::GetIO(), Frame);
+				ImGui::NewFrame();
+				if (ContextIdx == 0)
+				{
+					DrawSubplots(Frame);
+				}
+				else
+				{
+					DrawSubplotsParallel(Frame);
+				}
+				ImGui::Render();
+			}
+
+			ImGui::SetCurrentContext(Contexts[0]);
+			const ImDrawData& Expected = *ImGui::GetDrawData();
+			ImGui::SetCurrentContext(Contexts[1]);
+			const ImDrawData& Actual = *ImGui::GetDrawData();
+
+			const std::string Difference = CompareDrawData(Expected, Actual);
+			if (!Difference.empty())
+			{
+				fprintf(stderr, "Frame %d rendered in parallel differs: %s\n", Frame, Difference.c_str());
+				FailedFrame = Frame;
+			}
+		}
+
+		for (int ContextIdx = 0; ContextIdx < 2; ++ContextIdx)
+		{
+			ImPlot::DestroyContext(PlotContexts[ContextIdx]);
+			ImGui::DestroyContext(Contexts[ContextIdx]);
+		}
+
+		if (FailedFrame < 0)
+		{
+			fprintf(stderr, "%d frames rendered in parallel are identical\n", Frames);
+		}
+		return FailedFrame < 0;
+	}
+
+	void WriteTimings(FILE* File, const char* Name, const FTimings& Timings)
+	{
+		fprintf(File, "      \"%s\": { \"mean\": %.4f, \"p50\": %.4f, \"p99\": %.4f, \"max\": %.4f },\n", Name, Timings.Mean, Timings.P50, Timings.P99, Timings.Max);
+	}
+
+	void WriteResults(FILE* File, const std::vector<FSceneResult>& Results, int WarmupFrames, int Frames)
+	{
+		fprintf(File, "{\n");
+		fprintf(File, "  \"imgui_version\": \"%s\",\n", IMGUI_VERSION);
+		fprintf(File, "  \"implot_version\": \"%s\",\n", IMPLOT_VERSION);
+		fprintf(File, "  \"index_bits\": %d,\n", static_cast<int>(sizeof(ImDrawIdx) * 8));
+		fprintf(File, "  \"warmup_frames\": %d,\n", WarmupFrames);
+		fprintf(File, "  \"frames\": %d,\n", Frames);
+		fprintf(File, "  \"scenes\": [\n");
+		for (size_t Idx = 0; Idx < Results.size(); ++Idx)
+		{
+			const FSceneResult& Result = Results[Idx];
+			fprintf(File, "    {\n");
+			fprintf(File, "      \"name\": \"%s\",\n", Result.Name);
+			WriteTimings(File, "new_frame_ms", Result.NewFrame);
+			WriteTimings(File, "widgets_ms", Result.Widgets);
+			WriteTimings(File, "render_ms", Result.Render);
+			WriteTimings(File, "frame_ms", Result.Frame);
+			fprintf(File, "      \"vertices\": %.1f,\n", Result.Vertices);
+			fprintf(File, "      \"indices\": %.1f,\n", Result.Indices);
+			fprintf(File, "      \"commands\": %.1f,\n", Result.Commands);
+			fprintf(File, "      \"draw_lists\": %.1f,\n", Result.DrawLists);
+			fprintf(File, "      \"allocations_per_frame\": %.1f,\n", Result.Allocations);
+			fprintf(File, "      \"allocated_bytes_per_frame\": %.1f\n", Result.AllocatedBytes);
+			fprintf(File, "    }%s\n", (Idx + 1 < Results.size()) ? "," : "");
+		}
+		fprintf(File, "  ]\n");
+		fprintf(File, "}\n");
+	}
+
+	void PrintUsage()
+	{
+		fprintf(stderr, "Usage: ImGuiBenchmark [--frames N] [--warmup N] [--scene name[,name...]] [--out file] [--list] [--check]\n");
+	}
+}
+
+int main(int ArgCount, char** Args)
+{
+	int Frames = 300;
+	int WarmupFrames = 30;
+	std::string SceneFilter;
+	const char* OutPath = nullptr;
+	bool bCheck = false;
+
+	for (int ArgIdx = 1; ArgIdx < ArgCount; ++ArgIdx)
+	{
+		const char* Arg = Args[ArgIdx];
+		const bool bHasValue = ArgIdx + 1 < ArgCount;
+		if (strcmp(Arg, "--frames") == 0 && bHasValue)
+		{
+			Frames = std::max(1, atoi(Args[++ArgIdx]));
+		}
+		else if (strcmp(Arg, "--warmup") == 0 && bHasValue)
+		{
+			WarmupFrames = std::max(0, atoi(Args[++ArgIdx]));
+		}
+		else if (strcmp(Arg, "--scene") == 0 && bHasValue)
+		{
+			SceneFilter = std::string(",") + Args[++ArgIdx] + ",";
+		}
+		else if (strcmp(Arg, "--out") == 0 && bHasValue)
+		{
+			OutPath = Args[++ArgIdx];
+		}
+		else if (strcmp(Arg, "--check") == 0)
+		{
+			bCheck = true;
+		}
+		else if (strcmp(Arg, "--list") == 0)
+		{
+			for (const FScene& Scene : Scenes)
+			{
+				printf("%s\n", Scene.Name);
+			}
+			return 0;
+		}
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	IMGUI_CHECKVERSION();
+	ImGui::SetAllocatorFunctions(BenchmarkMalloc, BenchmarkFree);
+
+	if (bCheck)
+	{
+		return CheckParallelRender(Frames) ? 0 : 1;
+	}
+
+	std::vector<FSceneResult> Results;
+	for (const FScene& Scene : Scenes)
+	{
+		if (SceneFilter.empty() || SceneFilter.find(std::string(",") + Scene.Name + ",") != std::string::npos)
+		{
+			fprintf(stderr, "Running %s...\n", Scene.Name);
+			Results.push_back(RunScene(Scene, WarmupFrames, Frames));
+		}
+	}
+
+	if (Results.empty())
+	{
+		fprintf(stderr, "No scene matches '%s', see --list\n", SceneFilter.c_str());
+		return 1;
+	}
+
+	FILE* File = OutPath ? fopen(OutPath, "w") : stdout;
+	if (!File)
+	{
+		fprintf(stderr, "Failed to open %s\n", OutPath);
+		return 1;
+	}
+
+	WriteResults(File, Results, WarmupFrames, Frames);
+
+	if (File != stdout)
+	{
+		fclose(File);
+	}
+	return 0;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+// Standalone counterpart of Source/ImGui/Public/ImGuiConfig.h, keeping the settings that change what ImGui and ImPlot
+// compile to without depending on Unreal types
+
+#define IMGUI_DISABLE_OBSOLETE_FUNCTIONS
+#define IMGUI_DISABLE_DEFAULT_ALLOCATORS
+
+/// Same default as the plugin, define IMGUI_USE_32BIT_INDICES=0 to benchmark ImGui's default 16-bit indices
+#ifndef IMGUI_USE_32BIT_INDICES
+#define IMGUI_USE_32BIT_INDICES 1
+#endif
+
+#if IMGUI_USE_32BIT_INDICES
+#define ImDrawIdx unsigned int
+#endif
@@ -0,0 +1,9 @@
+// Same unity of sources as Source/ImGui/Private/ImGuiConfig.cpp, keep both lists in sync
+#include <imgui.cpp>
+#include <imgui_demo.cpp>
+#include <imgui_draw.cpp>
+#include <imgui_tables.cpp>
+#include <imgui_widgets.cpp>
+#include <implot.cpp>
+#include <implot_demo.cpp>
+#include <implot_items.cpp>